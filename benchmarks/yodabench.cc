@@ -0,0 +1,322 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+/// @file Micro- and macro-benchmarks of the core YODA operations, with JSON output
+
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Scatter2D.h"
+#include "YODA/ReaderYODA.h"
+#include "YODA/WriterYODA.h"
+#include "YODA/Sampler.h"
+#include "YODA/Utils/BinSearcher.h"
+#include "YODA/Utils/MathUtils.h"
+#include "YODA/Exceptions.h"
+#include "YODA/Config/YodaConfig.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <memory>
+#include <random>
+#include <regex>
+#include <chrono>
+#include <functional>
+using namespace std;
+using namespace YODA;
+
+
+namespace {
+
+  const char* USAGE =
+    "Usage: yodabench [options]\n"
+    "\n"
+    "Time the core YODA operations -- bin lookup, filling, merging, rebinning,\n"
+    "covariance matrices and YODA-format reading and writing -- and write the\n"
+    "results as JSON, for comparison between builds and releases.\n"
+    "\n"
+    "Options:\n"
+    "  -o, --output PATH    write the JSON results to PATH (default: stdout)\n"
+    "  -m, --match PATT     only run the benchmarks whose names match this regex\n"
+    "  -t, --min-time SECS  minimum time to repeat each benchmark for (default: 0.5)\n"
+    "  -q, --quick          use smaller inputs and a shorter minimum time, as a smoke test\n"
+    "  -l, --list           list the benchmark names and exit\n"
+    "  -h, --help           show this help message and exit\n";
+
+
+  /// Sink for benchmark results, so the work being timed isn't optimised away
+  volatile double SINK = 0;
+
+
+  /// One benchmark's timing, as a time per call and the equivalent rate of the benchmark's unit of work
+  struct Result {
+    string name;
+    size_t calls;
+    double seconds; //< per call
+    double work; //< units of work per call
+    string unit; //< name of the unit of work, e.g. "fills" or "MB"
+  };
+
+
+  /// A named benchmark, returning the number of units of work done per call
+  struct Benchmark {
+    string name;
+    string unit;
+    function<double()> setup; //< run once untimed, returning the work per call
+    function<void()> call;
+  };
+
+
+  /// Repeat @a f for at least @a mintime seconds, returning the time per call and setting @a ncalls
+  double timePerCall(const function<void()>& f, double mintime, size_t& ncalls) {
+    f(); //< warm up caches and lazily-built state
+    size_t n = 1;
+    while (true) {
+      const auto start = chrono::steady_clock::now();
+      for (size_t i = 0; i < n; ++i) f();
+      const double dt = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+      if (dt >= mintime) {
+        ncalls = n;
+        return dt / n;
+      }
+      // Aim a little past the minimum time next round, growing at least twofold
+      n = (dt > 0) ? max(2*n, size_t(1.2 * n * mintime / dt)) : 10*n;
+    }
+  }
+
+
+  /// Escape a string for a JSON string literal
+  string jsonStr(const string& s) {
+    ostringstream oss;
+    oss << '"';
+    for (char c : s) {
+      if (c == '"' || c == '\\') oss << '\\' << c;
+      else if ((unsigned char) c < 0x20) oss << "\\u" << hex << setw(4) << setfill('0') << int(c) << dec;
+      else oss << c;
+    }
+    oss << '"';
+    return oss.str();
+  }
+
+
+  void writeJSON(ostream& os, const vector<Result>& results, double mintime, bool quick) {
+    os << "{\n"
+       << "  \"yoda_version\": " << jsonStr(version()) << ",\n"
+       << "  \"min_time\": " << mintime << ",\n"
+       << "  \"quick\": " << (quick ? "true" : "false") << ",\n"
+       << "  \"benchmarks\": [";
+    os << setprecision(6);
+    for (size_t i = 0; i < results.size(); ++i) {
+      const Result& r = results[i];
+      os << (i ? ",\n" : "\n")
+         << "    {\"name\": " << jsonStr(r.name)
+         << ", \"calls\": " << r.calls
+         << ", \"seconds_per_call\": " << r.seconds
+         << ", \"unit\": " << jsonStr(r.unit)
+         << ", \"per_call\": " << r.work
+         << ", \"per_second\": " << r.work / r.seconds
+         << ", \"ns_per_unit\": " << 1e9 * r.seconds / r.work << "}";
+    }
+    os << "\n  ]\n}\n";
+  }
+
+
+  /// Uniform random numbers in [lo, hi), from a fixed seed so every run does the same work
+  vector<double> randoms(size_t n, double lo, double hi, unsigned seed=1) {
+    mt19937 rng(seed);
+    uniform_real_distribution<double> dist(lo, hi);
+    vector<double> rtn(n);
+    for (double& x : rtn) x = dist(rng);
+    return rtn;
+  }
+
+
+  /// Synthetic Rivet-like output of @a nobjs histograms and profiles, of 10-60 bins each
+  vector< unique_ptr<AnalysisObject> > syntheticObjects(size_t nobjs) {
+    vector< unique_ptr<AnalysisObject> > rtn;
+    const vector<double> xs = randoms(100, 0.0, 1.0, 2);
+    for (size_t i = 0; i < nobjs; ++i) {
+      const string path = "/BENCH_ANALYSIS_" + to_string(i/50) + "/d" + to_string(i%50) + "-x01-y01";
+      const size_t nbins = 10 + (i % 51);
+      if (i % 4 == 3) {
+        Profile1D* p = new Profile1D(nbins, 0.0, 1.0, path);
+        for (size_t j = 0; j < xs.size(); ++j) p->fill(xs[j], xs[(j+1) % xs.size()], 1.0 + 0.01*j);
+        rtn.emplace_back(p);
+      } else {
+        Histo1D* h = new Histo1D(nbins, 0.0, 1.0, path);
+        for (size_t j = 0; j < xs.size(); ++j) h->fill(xs[j], 1.0 + 0.01*j);
+        rtn.emplace_back(h);
+      }
+    }
+    return rtn;
+  }
+
+
+  vector<Benchmark> mkBenchmarks(bool quick) {
+    vector<Benchmark> rtn;
+    const size_t NX = quick ? 10000 : 1000000;
+
+    // Bin lookup on regular, logarithmic and irregular edges
+    auto edges = make_shared< map<string, vector<double> > >();
+    (*edges)["lin"] = linspace(1000, 0.0, 100.0);
+    (*edges)["log"] = logspace(1000, 1.0, 1e4);
+    vector<double> irregular = randoms(1001, 0.0, 100.0, 3);
+    sort(irregular.begin(), irregular.end());
+    (*edges)["irregular"] = irregular;
+    for (const auto& ne : *edges) {
+      auto bs = make_shared<Utils::BinSearcher>(ne.second);
+      auto xs = make_shared< vector<double> >(randoms(NX, ne.second.front(), ne.second.back(), 4));
+      rtn.push_back(Benchmark{"binsearcher/index/" + ne.first + "-1000bins", "lookups",
+            [=]() { return double(xs->size()); },
+            [=]() { size_t sum = 0; for (double x : *xs) sum += bs->index(x); SINK = sum; }});
+    }
+
+    // Fill throughput
+    auto fx = make_shared< vector<double> >(randoms(NX, 0.0, 1.0, 5));
+    auto fy = make_shared< vector<double> >(randoms(NX, 0.0, 1.0, 6));
+    auto h1 = make_shared<Histo1D>(100, 0.0, 1.0);
+    rtn.push_back(Benchmark{"histo1d/fill-100bins", "fills", [=]() { return double(fx->size()); },
+          [=]() { for (double x : *fx) h1->fill(x); SINK = h1->sumW(); }});
+    auto h2 = make_shared<Histo2D>(50, 0.0, 1.0, 50, 0.0, 1.0);
+    rtn.push_back(Benchmark{"histo2d/fill-50x50bins", "fills", [=]() { return double(fx->size()); },
+          [=]() { for (size_t i = 0; i < fx->size(); ++i) h2->fill((*fx)[i], (*fy)[i]); SINK = h2->sumW(); }});
+    auto p1 = make_shared<Profile1D>(100, 0.0, 1.0);
+    rtn.push_back(Benchmark{"profile1d/fill-100bins", "fills", [=]() { return double(fx->size()); },
+          [=]() { for (size_t i = 0; i < fx->size(); ++i) p1->fill((*fx)[i], (*fy)[i]); SINK = p1->sumW(); }});
+
+    // Merging by operator+=
+    auto addh1 = make_shared<Histo1D>(1000, 0.0, 1.0), srch1 = make_shared<Histo1D>(1000, 0.0, 1.0);
+    auto addh2 = make_shared<Histo2D>(100, 0.0, 1.0, 100, 0.0, 1.0), srch2 = make_shared<Histo2D>(100, 0.0, 1.0, 100, 0.0, 1.0);
+    auto addp1 = make_shared<Profile1D>(1000, 0.0, 1.0), srcp1 = make_shared<Profile1D>(1000, 0.0, 1.0);
+    rtn.push_back(Benchmark{"histo1d/add-1000bins", "merges", []() { return 1.0; },
+          [=]() { *addh1 += *srch1; SINK = addh1->numBins(); }});
+    rtn.push_back(Benchmark{"histo2d/add-100x100bins", "merges", []() { return 1.0; },
+          [=]() { *addh2 += *srch2; SINK = addh2->numBins(); }});
+    rtn.push_back(Benchmark{"profile1d/add-1000bins", "merges", []() { return 1.0; },
+          [=]() { *addp1 += *srcp1; SINK = addp1->numBins(); }});
+
+    // Sampling toy events from histogram templates
+    auto tmpl1 = make_shared<Histo1D>(1000, 0.0, 1.0);
+    for (double x : *fx) tmpl1->fill(x);
+    auto smp1 = make_shared<Histo1DSampler>(*tmpl1);
+    auto sx = make_shared< vector<double> >(NX), sy = make_shared< vector<double> >(NX);
+    rtn.push_back(Benchmark{"histo1dsampler/sample-1000bins", "draws", [=]() { return double(sx->size()); },
+          [=]() { smp1->sample(*sx); SINK = sx->back(); }});
+    auto tmpl2 = make_shared<Histo2D>(100, 0.0, 1.0, 100, 0.0, 1.0);
+    for (size_t i = 0; i < fx->size(); ++i) tmpl2->fill((*fx)[i], (*fy)[i]);
+    auto smp2 = make_shared<Histo2DSampler>(*tmpl2);
+    rtn.push_back(Benchmark{"histo2dsampler/sample-100x100bins", "draws", [=]() { return double(sx->size()); },
+          [=]() { smp2->sample(sx->data(), sy->data(), sx->size()); SINK = sy->back(); }});
+
+    // Rebinning, which works on a copy each time, so the copy is timed alone too
+    const size_t NREBIN = quick ? 1000 : 10000;
+    auto axis = make_shared<Histo1D::Axis>(NREBIN, 0.0, 1.0);
+    rtn.push_back(Benchmark{"axis1d/copy-" + to_string(NREBIN) + "bins", "copies", []() { return 1.0; },
+          [=]() { Histo1D::Axis a(*axis); SINK = a.numBins(); }});
+    rtn.push_back(Benchmark{"axis1d/copy+rebinBy2-" + to_string(NREBIN) + "bins", "rebins", []() { return 1.0; },
+          [=]() { Histo1D::Axis a(*axis); a.rebinBy(2); SINK = a.numBins(); }});
+    rtn.push_back(Benchmark{"axis1d/copy+rebinBy10-" + to_string(NREBIN) + "bins", "rebins", []() { return 1.0; },
+          [=]() { Histo1D::Axis a(*axis); a.rebinBy(10); SINK = a.numBins(); }});
+
+    // Covariance matrix of a scatter with many correlated systematic variations
+    const size_t NPTS = quick ? 20 : 100, NVARS = quick ? 5 : 20;
+    auto scat = make_shared<Scatter2D>();
+    const vector<double> errs = randoms(NPTS*(NVARS+1), 0.01, 0.1, 7);
+    for (size_t i = 0; i < NPTS; ++i) scat->addPoint(i + 0.5, 1.0, 0.5, errs[i]);
+    for (size_t i = 0; i < NPTS; ++i)
+      for (size_t v = 0; v < NVARS; ++v)
+        scat->point(i).setYErrs(errs[NPTS*(v+1) + i], "syst" + to_string(v));
+    rtn.push_back(Benchmark{"scatter2d/covarianceMatrix-" + to_string(NPTS) + "pts-" + to_string(NVARS) + "vars",
+          "matrices", []() { return 1.0; },
+          [=]() { SINK = scat->covarianceMatrix()[0][0]; }});
+
+    // YODA-format writing and reading, in memory so that the formatting and parsing are measured, not the disk
+    for (size_t nobjs : quick ? vector<size_t>{1000} : vector<size_t>{10000, 100000}) {
+      auto aos = make_shared< vector< unique_ptr<AnalysisObject> > >();
+      auto text = make_shared<string>();
+      const string suffix = to_string(nobjs/1000) + "k-objects";
+      rtn.push_back(Benchmark{"writeryoda/write-" + suffix, "MB",
+            [=]() {
+              *aos = syntheticObjects(nobjs);
+              ostringstream oss;
+              WriterYODA::write(oss, *aos);
+              *text = oss.str();
+              return text->size() / 1e6;
+            },
+            [=]() { ostringstream oss; WriterYODA::write(oss, *aos); SINK = oss.tellp(); }});
+      rtn.push_back(Benchmark{"readeryoda/read-" + suffix, "MB",
+            [=]() { return text->size() / 1e6; },
+            [=]() {
+              istringstream iss(*text);
+              vector<AnalysisObject*> back;
+              ReaderYODA::create().read(iss, back);
+              SINK = back.size();
+              for (AnalysisObject* ao : back) delete ao;
+            }});
+    }
+
+    return rtn;
+  }
+
+}
+
+
+int main(int argc, char* argv[]) {
+  string outfile = "-", match;
+  double mintime = -1;
+  bool quick = false, list = false;
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const string arg = argv[i];
+      // Fetch the value of an option which takes an argument
+      auto optval = [&]() -> string {
+        if (i+1 >= argc) throw UserError("Option " + arg + " requires an argument");
+        return argv[++i];
+      };
+      if (arg == "-h" || arg == "--help") { cout << USAGE; return EXIT_SUCCESS; }
+      else if (arg == "-o" || arg == "--output") outfile = optval();
+      else if (arg == "-m" || arg == "--match") match = optval();
+      else if (arg == "-t" || arg == "--min-time") mintime = atof(optval().c_str());
+      else if (arg == "-q" || arg == "--quick") quick = true;
+      else if (arg == "-l" || arg == "--list") list = true;
+      else throw UserError("Unknown argument " + arg);
+    }
+    if (mintime < 0) mintime = quick ? 0.02 : 0.5;
+
+    const regex re(match);
+    vector<Result> results;
+    for (const Benchmark& b : mkBenchmarks(quick)) {
+      if (!match.empty() && !regex_search(b.name, re)) continue;
+      if (list) { cout << b.name << endl; continue; }
+      Result r;
+      r.name = b.name;
+      r.unit = b.unit;
+      r.work = b.setup();
+      r.seconds = timePerCall(b.call, mintime, r.calls);
+      cerr << left << setw(50) << r.name << " " << right << setw(12) << setprecision(4)
+           << r.work / r.seconds << " " << r.unit << "/s" << endl;
+      results.push_back(r);
+    }
+    if (list) return EXIT_SUCCESS;
+
+    if (outfile == "-") {
+      writeJSON(cout, results, mintime, quick);
+    } else {
+      ofstream f(outfile.c_str());
+      writeJSON(f, results, mintime, quick);
+      if (!f) throw WriteError("Couldn't write to " + outfile);
+    }
+
+  } catch (const std::exception& e) {
+    cerr << "yodabench: " << e.what() << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+/// @file Compaction of checkpoint files written by YODA::CheckpointWriter
+
+#include "YODA/Checkpoint.h"
+#include "YODA/Exceptions.h"
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+using namespace std;
+using namespace YODA;
+
+
+namespace {
+
+  const char* USAGE =
+    "Usage: yodacompact [options] <checkpointfile> [<checkpointfile> ...]\n"
+    "  e.g. yodacompact run.yoda.gz  (rewrite run.yoda.gz in place)\n"
+    "    or yodacompact -o final.yoda run.yoda\n"
+    "\n"
+    "Rewrite YODA checkpoint files, to which changed objects have been appended at\n"
+    "each checkpoint, with only the latest version of each object.\n"
+    "\n"
+    "Options:\n"
+    "  -o, --output PATH    write the result to PATH rather than replacing the input (one input only)\n"
+    "  -q, --quiet          don't report the number of objects kept\n"
+    "  -h, --help           show this help message and exit\n";
+
+}
+
+
+int main(int argc, char* argv[]) {
+  string outfile;
+  bool quiet = false;
+  vector<string> inputs;
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const string arg = argv[i];
+      // Fetch the value of an option which takes an argument
+      auto optval = [&]() -> string {
+        if (i+1 >= argc) throw UserError("Option " + arg + " requires an argument");
+        return argv[++i];
+      };
+      if (arg == "-h" || arg == "--help") { cout << USAGE; return EXIT_SUCCESS; }
+      else if (arg == "-o" || arg == "--output") outfile = optval();
+      else if (arg == "-q" || arg == "--quiet") quiet = true;
+      else if (arg.size() > 1 && arg[0] == '-') throw UserError("Unknown option " + arg);
+      else inputs.push_back(arg);
+    }
+    if (inputs.empty()) {
+      cerr << USAGE;
+      return EXIT_FAILURE;
+    }
+    if (!outfile.empty() && inputs.size() > 1) throw UserError("Only one input can be given with --output");
+
+    for (const string& infile : inputs) {
+      const size_t n = compactCheckpoint(infile, outfile);
+      if (!quiet) cout << (outfile.empty() ? infile : outfile) << ": " << n << " objects" << endl;
+    }
+
+  } catch (const std::exception& e) {
+    cerr << "yodacompact: " << e.what() << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
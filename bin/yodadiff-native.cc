@@ -0,0 +1,344 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+/// @file Native implementation of yodadiff, comparing object pairs in parallel
+
+#include "YODA/IO.h"
+#include "YODA/Counter.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Profile2D.h"
+#include "YODA/Scatter1D.h"
+#include "YODA/Scatter2D.h"
+#include "YODA/Scatter3D.h"
+#include "YODA/Exceptions.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <memory>
+#include <regex>
+#include <thread>
+#include <atomic>
+#include <exception>
+using namespace std;
+using namespace YODA;
+
+
+namespace {
+
+  const char* USAGE =
+    "Usage: yodadiff-native [options] <datafile1> <datafile2>\n"
+    "\n"
+    "Compare analysis objects between two YODA-readable data files, with the same\n"
+    "rules and options as yodadiff. Each object is converted to its scatter\n"
+    "representation and the point values and errors compared within a relative\n"
+    "tolerance, stopping at the first differing point of each object unless\n"
+    "--verbose is given. The object pairs are compared on a pool of threads.\n"
+    "\n"
+    "Options:\n"
+    "  -o, --output PATH    write output to the given file (default: stdout)\n"
+    "  -t, --tol TOL        relative tolerance of numerical difference permitted before complaining (default: 1e-05)\n"
+    "  -l, --list           only print paths of mismatching objects, skip diff details\n"
+    "  -a, --annotations    also compare annotations (not done by default)\n"
+    "  -m, --match PATT     only compare histograms whose path matches this regex\n"
+    "  -M, --unmatch PATT   exclude histograms whose path matches this regex\n"
+    "  --ignore-missing     don't complain if an object in file #1 is not found in file #2\n"
+    "  --ignore-new         don't complain if an object in file #2 is not found in file #1\n"
+    "  -v, --verbose        report every differing point, not just the first of each object\n"
+    "  -j, --jobs N         number of threads to use (default: one per core)\n"
+    "  -q, --quiet          print nothing, only express comparison result via return code\n"
+    "  -h, --help           show this help message and exit\n";
+
+
+  struct Options {
+    double tol = 1e-5;
+    bool annotations = false;
+    bool verbose = false;
+    string file1, file2;
+  };
+
+
+  /// Tolerant numerical comparison, as in yodadiff but symmetric for negative values
+  inline bool eq(double a, double b, double tol) {
+    if (a == b) return true;
+    if (std::isnan(a) && std::isnan(b)) return true;
+    if (a == -b) return false;
+    return fabs(a - b) < tol * (fabs(a) + fabs(b));
+  }
+
+
+  string fmt(const char* f, double x) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), f, x);
+    return buf;
+  }
+
+
+  /// Point values and errors flattened as (val, err-, err+) per axis, for a tight comparison loop
+  template <size_t DIM, typename S>
+  vector<double> flatten(const S& s) {
+    vector<double> rtn;
+    rtn.reserve(3*DIM*s.numPoints());
+    for (const auto& pt : s.points()) {
+      for (size_t i = 1; i <= DIM; ++i) {
+        rtn.push_back(pt.val(i));
+        rtn.push_back(pt.errMinus(i));
+        rtn.push_back(pt.errPlus(i));
+      }
+    }
+    return rtn;
+  }
+
+
+  /// Description of the point at @a offset of a flattened scatter, as in yodadiff
+  template <size_t DIM>
+  string ptstr(const vector<double>& vals, size_t offset, double tol) {
+    string rtn = "(";
+    for (size_t i = 0; i < DIM; ++i) {
+      const double* v = &vals[offset + 3*i];
+      if (i > 0) rtn += ", ";
+      rtn += fmt("%.5g", v[0]);
+      if (eq(v[1], v[2], tol)) rtn += " +- " + fmt("%.5g", v[1]);
+      else rtn += " + " + fmt("%.5g", v[2]) + " - " + fmt("%.5g", v[1]);
+    }
+    return rtn + ")";
+  }
+
+
+  /// Compare the points of two scatters, writing any differences to @a msg
+  template <size_t DIM, typename S>
+  bool comparePoints(const string& path, const S& s1, const S& s2, const Options& opts, ostream& msg) {
+    if (s1.numPoints() != s2.numPoints()) {
+      msg << "Data objects with path '" << path << "' have different numbers of points ("
+          << s1.numPoints() << " and " << s2.numPoints() << ") in " << opts.file1 << " and " << opts.file2 << "\n";
+      return false;
+    }
+    const vector<double> v1 = flatten<DIM>(s1), v2 = flatten<DIM>(s2);
+    const size_t n = v1.size();
+    bool clean = true;
+    for (size_t i = 0; i < n; ++i) {
+      if (eq(v1[i], v2[i], opts.tol)) continue;
+      // Found a difference: describe every differing axis of this point
+      const size_t ipt = i / (3*DIM), offset = ipt * 3*DIM;
+      string axes;
+      for (size_t j = 0; j < DIM; ++j) {
+        const size_t k = offset + 3*j;
+        if (eq(v1[k], v2[k], opts.tol) && eq(v1[k+1], v2[k+1], opts.tol) && eq(v1[k+2], v2[k+2], opts.tol)) continue;
+        axes += (axes.empty() ? "" : ", ") + string(1, "xyz"[j]);
+      }
+      if (clean) {
+        msg << "Data points differ for data objects with path '" << path << "' in "
+            << opts.file1 << " and " << opts.file2 << ":\n";
+        clean = false;
+      }
+      msg << "  Point #" << ipt << " (different " << axes << "): "
+          << ptstr<DIM>(v1, offset, opts.tol) << " vs. " << ptstr<DIM>(v2, offset, opts.tol) << "\n";
+      if (!opts.verbose) {
+        if (offset + 3*DIM < n) msg << "  (later points not compared: use --verbose to list them all)\n";
+        break;
+      }
+      i = offset + 3*DIM - 1;
+    }
+    return clean;
+  }
+
+
+  /// Compare the scatter representations of two objects of the same type
+  bool compareData(const string& path, const AnalysisObject& ao1, const AnalysisObject& ao2, const Options& opts, ostream& msg) {
+    #define YODA_DIFF_AS(TYPE, DIM)                                     \
+    if (const TYPE* a = dynamic_cast<const TYPE*>(&ao1)) {              \
+      const TYPE& b = dynamic_cast<const TYPE&>(ao2);                   \
+      return comparePoints<DIM>(path, mkScatter(*a), mkScatter(b), opts, msg); \
+    }
+    YODA_DIFF_AS(Counter, 1)
+    YODA_DIFF_AS(Histo1D, 2)
+    YODA_DIFF_AS(Profile1D, 2)
+    YODA_DIFF_AS(Histo2D, 3)
+    YODA_DIFF_AS(Profile2D, 3)
+    YODA_DIFF_AS(Scatter1D, 1)
+    YODA_DIFF_AS(Scatter2D, 2)
+    YODA_DIFF_AS(Scatter3D, 3)
+    #undef YODA_DIFF_AS
+    cerr << "WARNING! Could not create a '" << path << "' scatter for comparison" << endl;
+    return true;
+  }
+
+
+  /// Compare one pair of objects, as yodadiff does
+  bool compare(const string& path, const AnalysisObject* ao1, const AnalysisObject* ao2, const Options& opts, ostream& msg) {
+    if (ao1->type() != ao2->type()) {
+      msg << "Data objects with path '" << path << "' have different types (" << ao1->type() << " and "
+          << ao2->type() << ") in " << opts.file1 << " and " << opts.file2 << "\n";
+      return false;
+    }
+    if (!compareData(path, *ao1, *ao2, opts, msg)) return false;
+    bool clean = true;
+    if (opts.annotations) {
+      set<string> anns;
+      for (const string& a : ao1->annotations()) anns.insert(a);
+      for (const string& a : ao2->annotations()) anns.insert(a);
+      for (const string& a : anns) {
+        const string a1 = ao1->hasAnnotation(a) ? ao1->annotation(a) : "None";
+        const string a2 = ao2->hasAnnotation(a) ? ao2->annotation(a) : "None";
+        if (a1 == a2 && ao1->hasAnnotation(a) == ao2->hasAnnotation(a)) continue;
+        msg << "Data objects with path '" << path << "' have different '" << a << "' annotations ('"
+            << a1 << "' and '" << a2 << "') in " << opts.file1 << " and " << opts.file2 << "\n";
+        clean = false;
+      }
+    }
+    return clean;
+  }
+
+
+  /// Read the objects in @a filename which pass the path filters, keyed by path
+  void readFiltered(const string& filename, const regex* match, const regex* unmatch,
+                    vector<AnalysisObject*>& aos, map<string,AnalysisObject*>& bypath) {
+    read(filename, aos);
+    for (AnalysisObject* ao : aos) {
+      if (match && !regex_search(ao->path(), *match)) continue;
+      if (unmatch && regex_search(ao->path(), *unmatch)) continue;
+      bypath[ao->path()] = ao;
+    }
+  }
+
+}
+
+
+int main(int argc, char* argv[]) {
+  Options opts;
+  string outfile = "-";
+  bool list = false, quiet = false, ignoreMissing = false, ignoreNew = false;
+  unique_ptr<regex> match, unmatch;
+  size_t nthreads = 0;
+  vector<string> filenames;
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const string arg = argv[i];
+      // Fetch the value of an option which takes an argument
+      auto optval = [&]() -> string {
+        if (i+1 >= argc) throw UserError("Option " + arg + " requires an argument");
+        return argv[++i];
+      };
+      if (arg == "-h" || arg == "--help") { cout << USAGE; return EXIT_SUCCESS; }
+      else if (arg == "-o" || arg == "--output") outfile = optval();
+      else if (arg == "-t" || arg == "--tol") opts.tol = atof(optval().c_str());
+      else if (arg == "-l" || arg == "--list") list = true;
+      else if (arg == "-a" || arg == "--annotations") opts.annotations = true;
+      else if (arg == "-m" || arg == "--match") match.reset(new regex(optval()));
+      else if (arg == "-M" || arg == "--unmatch") unmatch.reset(new regex(optval()));
+      else if (arg == "--ignore-missing") ignoreMissing = true;
+      else if (arg == "--ignore-new") ignoreNew = true;
+      else if (arg == "-v" || arg == "--verbose") opts.verbose = true;
+      else if (arg == "-j" || arg == "--jobs") nthreads = atoi(optval().c_str());
+      else if (arg == "-q" || arg == "--quiet") quiet = true;
+      else if (arg.size() > 1 && arg[0] == '-') throw UserError("Unknown option " + arg);
+      else filenames.push_back(arg);
+    }
+    if (filenames.size() != 2) {
+      cerr << "ERROR! Please supply *two* YODA files for comparison\n" << USAGE;
+      return 7;
+    }
+    opts.file1 = filenames[0];
+    opts.file2 = filenames[1];
+    if (nthreads == 0) nthreads = max<size_t>(thread::hardware_concurrency(), 1);
+
+    // Read the two files concurrently
+    vector<AnalysisObject*> aos1, aos2;
+    map<string,AnalysisObject*> bypath1, bypath2;
+    exception_ptr err2;
+    thread reader2([&]() {
+        try { readFiltered(opts.file2, match.get(), unmatch.get(), aos2, bypath2); }
+        catch (...) { err2 = current_exception(); }
+      });
+    try {
+      readFiltered(opts.file1, match.get(), unmatch.get(), aos1, bypath1);
+    } catch (...) {
+      reader2.join();
+      throw;
+    }
+    reader2.join();
+    if (err2) rethrow_exception(err2);
+    vector< unique_ptr<AnalysisObject> > owned(aos1.begin(), aos1.end());
+    for (AnalysisObject* ao : aos2) owned.emplace_back(ao);
+
+    ofstream fout;
+    if (outfile != "-") fout.open(outfile.c_str());
+    ostream& out = (outfile != "-") ? fout : cout;
+    const bool details = !quiet && !list;
+
+    // Check the numbers and paths of the objects in each file
+    bool clean = true;
+    set<string> paths;
+    for (const auto& p : bypath1) paths.insert(p.first);
+    for (const auto& p : bypath2) paths.insert(p.first);
+    if (bypath1.size() != bypath2.size() || paths.size() != bypath1.size()) {
+      clean = false;
+      if (details && !(ignoreMissing || ignoreNew))
+        out << "Different " << (bypath1.size() != bypath2.size() ? "numbers of data objects" : "data object paths")
+            << " in " << opts.file1 << " and " << opts.file2 << "\n";
+    }
+
+    // Compare each object pair, in parallel, collecting the reports to write out in path order
+    const vector<string> vpaths(paths.begin(), paths.end());
+    vector<char> cleans(vpaths.size(), 1);
+    vector<string> msgs(vpaths.size());
+    atomic<size_t> next(0);
+    vector<exception_ptr> errs(nthreads);
+    auto worker = [&](size_t iworker) {
+      try {
+        for (size_t i = next++; i < vpaths.size(); i = next++) {
+          const string& path = vpaths[i];
+          const auto it1 = bypath1.find(path), it2 = bypath2.find(path);
+          ostringstream msg;
+          bool ok = true;
+          if (it1 == bypath1.end()) {
+            if (!ignoreNew) {
+              ok = false;
+              msg << "Data object '" << path << "' not found in " << opts.file1 << "\n";
+            }
+          } else if (it2 == bypath2.end()) {
+            if (!ignoreMissing) {
+              ok = false;
+              msg << "Data object '" << path << "' not found in " << opts.file2 << "\n";
+            }
+          } else {
+            ok = compare(path, it1->second, it2->second, opts, msg);
+          }
+          cleans[i] = ok;
+          msgs[i] = msg.str();
+        }
+      } catch (...) {
+        errs[iworker] = current_exception();
+        next = vpaths.size();
+      }
+    };
+    vector<thread> workers;
+    for (size_t i = 1; i < min(nthreads, vpaths.size()); ++i) workers.push_back(thread(worker, i));
+    worker(0);
+    for (thread& t : workers) t.join();
+    for (const exception_ptr& e : errs) if (e) rethrow_exception(e);
+
+    for (size_t i = 0; i < vpaths.size(); ++i) {
+      if (details) out << msgs[i];
+      if (!cleans[i] && list && !quiet) out << vpaths[i] << "\n";
+      clean &= bool(cleans[i]);
+    }
+    out.flush();
+    return clean ? EXIT_SUCCESS : 1;
+
+  } catch (const std::exception& e) {
+    cerr << "yodadiff-native: " << e.what() << endl;
+    return EXIT_FAILURE;
+  }
+}
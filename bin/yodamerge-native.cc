@@ -0,0 +1,108 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+/// @file Native implementation of yodamerge, streaming the inputs through a thread pool
+
+#include "YODA/Merge.h"
+#include "YODA/WriterYODA.h"
+#include "YODA/Exceptions.h"
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+using namespace std;
+using namespace YODA;
+
+
+namespace {
+
+  const char* USAGE =
+    "Usage: yodamerge-native [options] <yodafile1>[:<scale1>] <yodafile2>[:<scale2>] ...\n"
+    "  e.g. yodamerge-native run1.yoda run2.yoda run3.yoda  (unweighted merging of three runs)\n"
+    "    or yodamerge-native run1.yoda:2.0 run2.yoda:3.142  (weighted merging of two runs)\n"
+    "\n"
+    "Merge analysis objects from multiple YODA files, with the same rules and options\n"
+    "as yodamerge, but streaming the inputs through a pool of threads so that only one\n"
+    "merged copy of each object per thread needs to be held in memory.\n"
+    "\n"
+    "Options:\n"
+    "  -o, --output PATH          write output to specified path (default: stdout)\n"
+    "  -j, --jobs N               number of threads to use (default: one per core)\n"
+    "  --s1d-mode MODE            strategy for combining Scatter1D objects: one of\n"
+    "                             'first', 'combine', 'assume_mean' (default), 'add'\n"
+    "  --s2d-mode MODE            strategy for combining Scatter2D objects\n"
+    "  --s3d-mode MODE            strategy for combining Scatter3D objects\n"
+    "  --type-mismatch-mode MODE  strategy for objects whose types mismatch: 'first', 'scatter' (default)\n"
+    "  --add, --stack             force simple stacking (also forces all scatter modes to 'add')\n"
+    "  --no-veto-empty            don't remove empty (sumW=0) objects before applying merge heuristics\n"
+    "  --assume-normalized        DEPRECATED, AND DOES NOTHING\n"
+    "  -h, --help                 show this help message and exit\n";
+
+
+  /// Split a file[:scale] argument, treating a non-numeric suffix as part of the filename
+  pair<string,double> parseInput(const string& arg) {
+    const size_t icolon = arg.rfind(":");
+    if (icolon != string::npos) {
+      const string sscale = arg.substr(icolon+1);
+      char* end = nullptr;
+      const double scale = strtod(sscale.c_str(), &end);
+      if (!sscale.empty() && *end == '\0') return make_pair(arg.substr(0, icolon), scale);
+      cerr << "Error processing arg '" << arg << "' with file:scale format" << endl;
+    }
+    return make_pair(arg, 1.0);
+  }
+
+}
+
+
+int main(int argc, char* argv[]) {
+  MergeOptions opts;
+  string outfile = "-";
+  vector< pair<string,double> > inputs;
+
+  try {
+    for (int i = 1; i < argc; ++i) {
+      const string arg = argv[i];
+      // Fetch the value of an option which takes an argument
+      auto optval = [&]() -> string {
+        if (i+1 >= argc) throw UserError("Option " + arg + " requires an argument");
+        return argv[++i];
+      };
+      if (arg == "-h" || arg == "--help") { cout << USAGE; return EXIT_SUCCESS; }
+      else if (arg == "-o" || arg == "--output") outfile = optval();
+      else if (arg == "-j" || arg == "--jobs") opts.nthreads = atoi(optval().c_str());
+      else if (arg == "--s1d-mode" || arg == "--s1dmode") opts.s1dMode = mkScatterMergeMode(optval());
+      else if (arg == "--s2d-mode" || arg == "--s2dmode") opts.s2dMode = mkScatterMergeMode(optval());
+      else if (arg == "--s3d-mode" || arg == "--s3dmode") opts.s3dMode = mkScatterMergeMode(optval());
+      else if (arg == "--type-mismatch-mode") {
+        const string mode = optval();
+        if (mode != "first" && mode != "scatter") throw UserError("Unknown type mismatch mode: " + mode);
+        opts.mismatchToScatter = (mode == "scatter");
+      }
+      else if (arg == "--add" || arg == "--stack") opts.stack = true;
+      else if (arg == "--no-veto-empty") opts.vetoEmpty = false;
+      else if (arg == "--assume-normalized") { }
+      else if (arg.size() > 1 && arg[0] == '-') throw UserError("Unknown option " + arg);
+      else inputs.push_back(parseInput(arg));
+    }
+    if (inputs.empty()) {
+      cerr << USAGE;
+      return EXIT_FAILURE;
+    }
+
+    vector<AnalysisObject*> aos = merge(inputs, opts);
+    vector< unique_ptr<AnalysisObject> > owned(aos.begin(), aos.end());
+    WriterYODA writer;
+    writer.setThreads((opts.nthreads > 0) ? opts.nthreads : thread::hardware_concurrency());
+    writer.write(outfile, aos);
+
+  } catch (const std::exception& e) {
+    cerr << "yodamerge-native: " << e.what() << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
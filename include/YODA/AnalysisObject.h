@@ -8,8 +8,10 @@
 
 #include "YODA/Exceptions.h"
 #include "YODA/Utils/StringUtils.h"
+#include "YODA/Utils/MemoryUsage.h"
 #include "YODA/Config/BuildConfig.h"
 #include <iomanip>
+#include <limits>
 #include <string>
 #include <map>
 
@@ -77,8 +79,8 @@ namespace YODA {
     /// Reset this analysis object
     virtual void reset() = 0;
     
-    // variation parser
-    void parseVariations(){ return ; }
+    /// Unpack any error-breakdown annotation into the object's contents (no-op unless overridden)
+    virtual void parseVariations() { return ; }
 
     //@}
 
@@ -284,6 +286,17 @@ namespace YODA {
     ///    For scatter types, it is the total dimension of the points (e.g. Scatter3D -> dim=3).
     virtual size_t dim() const = 0;
 
+    /// @brief Breakdown of the memory used by this object
+    ///
+    /// Overridden by each object type: this base version counts only the
+    /// annotations and the base class itself.
+    virtual MemoryUsage memoryUsage() const {
+      MemoryUsage rtn;
+      rtn.object = sizeof(AnalysisObject);
+      rtn.annotations = Utils::heapSize(_annotations);
+      return rtn;
+    }
+
     //@}
 
 
@@ -5,7 +5,7 @@
 #include "YODA/Exceptions.h"
 #include "YODA/Bin.h"
 #include "YODA/Utils/MathUtils.h"
-#include "YODA/Utils/BinSearcher.h"
+#include "YODA/Utils/Binning.h"
 #include <limits>
 #include <string>
 
@@ -36,13 +36,13 @@ namespace YODA {
 
     /// Empty constructor
     Axis1D()
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _locked(false)
     { }
 
 
     /// Constructor accepting a list of bin edges
     Axis1D(const std::vector<double>& binedges)
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _locked(false)
     {
       addBins(binedges);
     }
@@ -54,7 +54,7 @@ namespace YODA {
     /// all the contents of the bins will be copied across, including
     /// the statistics
     Axis1D(const std::vector<BIN1D>& bins)
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _locked(false)
     {
       addBins(bins);
     }
@@ -63,7 +63,7 @@ namespace YODA {
     /// Constructor with the number of bins and the axis limits
     /// @todo Rewrite interface to use a pair for the low/high
     Axis1D(size_t nbins, double lower, double upper)
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _locked(false)
     {
       addBins(linspace(nbins, lower, upper));
     }
@@ -75,7 +75,8 @@ namespace YODA {
     /// all the contents of the bins will be copied across, including
     /// the statistics
     Axis1D(const Bins& bins, const DBN& dbn_tot, const DBN& dbn_uflow, const DBN& dbn_oflow)
-      : _dbn(dbn_tot), _underflow(dbn_uflow), _overflow(dbn_oflow), _locked(false)
+      : _dbn(dbn_tot), _underflow(dbn_uflow), _overflow(dbn_oflow),
+        _binning(Utils::Binning::empty()), _locked(false)
     {
       addBins(bins);
     }
@@ -88,6 +89,20 @@ namespace YODA {
       return bins().size();
     }
 
+    /// The bin lookup structures, shared with other axes of the same binning
+    const Utils::Binning::Ptr& binning() const {
+      return _binning;
+    }
+
+    /// Heap memory used by the bins and the lookup structures
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn;
+      rtn.bins = Utils::heapSize(_bins);
+      // The binning is shared, so only this axis's share of it is counted
+      rtn.index = (Utils::SHARED_PTR_OVERHEAD + sizeof(Utils::Binning) + _binning->heapSize()) / _binning.use_count();
+      return rtn;
+    }
+
     /// Return a vector of bins (const)
     const Bins& bins() const {
       return _bins;
@@ -115,7 +130,7 @@ namespace YODA {
     /// @note This only returns the finite edges, i.e. -inf and +inf are removed
     /// @todo Make the +-inf stripping controllable by a default-valued bool arg
     std::vector<double> xEdges() const {
-      std::vector<double> rtn(_binsearcher.edges().begin()+1, _binsearcher.edges().end()-1);
+      std::vector<double> rtn(_binning->xSearcher().edges().begin()+1, _binning->xSearcher().edges().end()-1);
       return rtn;
     }
 
@@ -134,7 +149,7 @@ namespace YODA {
     /// Returns an index of a bin at a given coord, -1 if no bin matches
     ssize_t binIndexAt(double coord) const {
       // Yes, this is robust even with an empty axis: there's always at least one outflow
-      return _indexes[_binsearcher.index(coord)];
+      return _binning->indexes()[_binning->xSearcher().index(coord)];
     }
 
     /// Return a bin at a given coordinate (non-const)
@@ -218,7 +233,7 @@ namespace YODA {
     /// @todo Should be a const ref arg?
     std::pair< std::vector<double>, std::vector<long> > _mk_edges_indexes(Bins& bins) const {
       std::vector<double> edges; edges.reserve(bins.size()+1); // Nbins+1 edges
-      std::vector<long> indexes; edges.reserve(bins.size()+2); // Nbins + 2*outflows
+      std::vector<long> indexes; indexes.reserve(bins.size()+2); // Nbins + 2*outflows
 
       // Sort the bins
       std::sort(bins.begin(), bins.end());
@@ -301,41 +316,41 @@ namespace YODA {
       if (newedges.size() < 2)
         throw UserError("Requested rebinning to an edge list which defines no bins");
       const Utils::BinSearcher newbs(newedges);
-      const std::vector<double> eshared = newbs.shared_edges(_binsearcher);
+      const std::vector<double> eshared = newbs.shared_edges(_binning->xSearcher());
       if (eshared.size() != newbs.size())
         throw BinningError("Requested rebinning to incompatible edges");
       // std::cout << "Before merging" << std::endl;
-      // for (double x : _binsearcher.edges()) std::cout << x << std::endl;
+      // for (double x : _binning->xSearcher().edges()) std::cout << x << std::endl;
       // If the new min finite edge isn't the same, merge it into the underflow
       // NB. Edge search match the *next* bin, so step back one unit... and note these are BinSearcher indices, i.e. i+1
       if (!fuzzyEquals(xMin(), newedges.front())) {
-        const size_t kmatch = _binsearcher.index(newedges.front()) - 1;
+        const size_t kmatch = _binning->xSearcher().index(newedges.front()) - 1;
         mergeBins(0, kmatch-1);
         _underflow += bin(0).dbn();
         eraseBin(0);
       }
       // std::cout << "Merged start bins" << std::endl;
-      // for (double x : _binsearcher.edges()) std::cout << x << std::endl;
+      // for (double x : _binning->xSearcher().edges()) std::cout << x << std::endl;
       // Now the same for the overflow
       if (!fuzzyEquals(xMax(), newedges.back())) {
-        const size_t kmatch = _binsearcher.index(newedges.back()) - 1;
+        const size_t kmatch = _binning->xSearcher().index(newedges.back()) - 1;
         // std::cout << newedges.back() << " -> " << kmatch << " .. " << _bins.size()-1 << " / " << numBins() << std::endl;
         mergeBins(kmatch, _bins.size()-1);
         _overflow += bin(_bins.size()-1).dbn();
         eraseBin(_bins.size()-1);
       }
       // std::cout << "Merged end bins" << std::endl;
-      // for (double x : _binsearcher.edges()) std::cout << x << std::endl;
+      // for (double x : _binning->xSearcher().edges()) std::cout << x << std::endl;
       // Now merge the in-range bins
       size_t jcurr = 0;
       for (size_t i = 1; i < newedges.size(); ++i) { //< we already know that i=0 matches (until we support merging into overflows)
-        const size_t kmatch = _binsearcher.index(newedges.at(i)) - 1; //< Will match the *next* bin, so step back one unit... and note these are BinSearcher indices
+        const size_t kmatch = _binning->xSearcher().index(newedges.at(i)) - 1; //< Will match the *next* bin, so step back one unit... and note these are BinSearcher indices
         assert(kmatch >= jcurr+1);
         mergeBins(jcurr, kmatch-1);
         jcurr += 1; //< The next bin to be merged, in the new numbering
       }
       // std::cout << "After merging" << std::endl;
-      // for (double x : _binsearcher.edges()) std::cout << x << std::endl;
+      // for (double x : _binning->xSearcher().edges()) std::cout << x << std::endl;
     }
 
     /// @brief Overloaded alias for rebinTo
@@ -359,8 +374,10 @@ namespace YODA {
 
     /// Add a contiguous set of bins to an axis, via their list of edges
     void addBins(const std::vector<double>& binedges) {
-      Bins newBins(_bins);
       if (binedges.size() == 0) return;
+      Bins newBins;
+      newBins.reserve(_bins.size() + binedges.size() - 1);
+      newBins.insert(newBins.end(), _bins.begin(), _bins.end());
 
       double low = binedges.front();
       for (size_t i = 1; i < binedges.size(); ++i) {
@@ -377,7 +394,9 @@ namespace YODA {
     /// Add a list of bins as pairs of lowEdge, highEdge
     void addBins(const std::vector<std::pair<double, double> >& binpairs) {
       // Make a copy of the current binning
-      Bins newBins(_bins);
+      Bins newBins;
+      newBins.reserve(_bins.size() + binpairs.size());
+      newBins.insert(newBins.end(), _bins.begin(), _bins.end());
 
       // Iterate over given bins
       for (size_t i = 0; i < binpairs.size(); ++i) {
@@ -390,8 +409,11 @@ namespace YODA {
 
     /// Add a list of Bin objects
     void addBins(const Bins& bins) {
-      Bins newBins(_bins);
-      for (const Bin& b : bins) newBins.push_back(b);
+      // Reserve up front: bins are expensive to copy, so reallocation is much slower than one pass
+      Bins newBins;
+      newBins.reserve(_bins.size() + bins.size());
+      newBins.insert(newBins.end(), _bins.begin(), _bins.end());
+      newBins.insert(newBins.end(), bins.begin(), bins.end());
       _updateAxis(newBins);
     }
 
@@ -455,16 +477,18 @@ namespace YODA {
     //@{
 
     bool sameBinning(const Axis1D& other) const {
+      // Identical binnings share a Binning, so this is the usual answer
+      if (_binning == other._binning) return true;
       if (numBins() != other.numBins()) return false;
-      if (_indexes != other._indexes) return false;
-      return _binsearcher.same_edges(other._binsearcher);
+      if (_binning->indexes() != other._binning->indexes()) return false;
+      return _binning->xSearcher().same_edges(other._binning->xSearcher());
     }
 
     bool subsetBinning(const Axis1D& other) const {
       const int ndiff = numBins() - other.numBins();
       if (ndiff == 0) return sameBinning(other);
       /// @todo Do we require the finite axis begin/end to be the same?
-      return !_binsearcher.shared_edges(other._binsearcher).empty();
+      return !_binning->xSearcher().shared_edges(other._binning->xSearcher()).empty();
     }
 
     //@}
@@ -531,9 +555,8 @@ namespace YODA {
 
       // Get the new cuts and indexes (throws if overlaps), and set them on the searcher
       const std::pair< std::vector<double>, std::vector<long> > es_is = _mk_edges_indexes(bins);
-      _binsearcher = Utils::BinSearcher(es_is.first);
-      _indexes = es_is.second;
-      _bins = bins;
+      _binning = Utils::Binning::get(es_is.first, es_is.second);
+      _bins.swap(bins);
     }
 
 
@@ -544,14 +567,14 @@ namespace YODA {
       assert(ito < numBins() && ifrom < ito);
 
       /// @todo Why do we need to re-find the bin indices?
-      const size_t from_ix = _binsearcher.index(bin(ifrom).xMid());
-      const size_t to_ix = _binsearcher.index(bin(ito).xMid());
+      const size_t from_ix = _binning->xSearcher().index(bin(ifrom).xMid());
+      const size_t to_ix = _binning->xSearcher().index(bin(ito).xMid());
       // std::cout << ifrom << " vs. " << from_ix << std::endl;
       // std::cout << ito << " vs. " << to_ix << std::endl;
 
       for (size_t i = from_ix; i <= to_ix; i++)
       // for (size_t i = ifrom; i <= ito; i++)
-        if (_indexes[i] == -1) return true;
+        if (_binning->indexes()[i] == -1) return true;
       return false;
     }
 
@@ -571,10 +594,8 @@ namespace YODA {
     DBN _underflow;
     DBN _overflow;
 
-    // Binsearcher, for searching bins
-    Utils::BinSearcher _binsearcher;
-    // Mapping from binsearcher indices to bin indices (allowing gaps)
-    std::vector<long> _indexes;
+    /// Bin searcher, and mapping from its indices to bin indices (allowing gaps), shared between axes
+    Utils::Binning::Ptr _binning;
 
     /// Whether modifying bin edges is permitted
     bool _locked;
@@ -6,7 +6,7 @@
 #include "YODA/Bin.h"
 #include "YODA/Utils/MathUtils.h"
 #include "YODA/Utils/Predicates.h"
-#include "YODA/Utils/BinSearcher.h"
+#include "YODA/Utils/Binning.h"
 #include <limits>
 #include <string>
 
@@ -47,14 +47,14 @@ namespace YODA {
 
     // Empty constructor
     Axis2D()
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _nx(0), _ny(0), _locked(false)
     {
       reset();
     }
 
     /// A constructor with specified x and y axis bin cuts.
     Axis2D(const Edges& xedges, const Edges& yedges)
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _nx(0), _ny(0), _locked(false)
     {
       addBins(xedges, yedges);
       reset();
@@ -64,7 +64,7 @@ namespace YODA {
     /// on each of the axis. Both axes are divided linearly.
     Axis2D(size_t nbinsX, const std::pair<double,double>& rangeX,
            size_t nbinsY, const std::pair<double,double>& rangeY)
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _nx(0), _ny(0), _locked(false)
     {
       addBins(linspace(nbinsX, rangeX.first, rangeX.second),
               linspace(nbinsY, rangeY.first, rangeY.second));
@@ -73,7 +73,7 @@ namespace YODA {
 
     /// Constructor accepting a list of bins
     Axis2D(const Bins& bins)
-      : _locked(false)
+      : _binning(Utils::Binning::empty()), _nx(0), _ny(0), _locked(false)
     {
       addBins(bins);
       reset();
@@ -83,8 +83,8 @@ namespace YODA {
     Axis2D(const Bins& bins,
            const DBN& totalDbn,
            const Outflows& outflows)
-      : _dbn(totalDbn), _outflows(outflows),
-        _locked(false) // Does this make sense?
+      : _dbn(totalDbn), _outflows(outflows), _binning(Utils::Binning::empty()),
+        _nx(0), _ny(0), _locked(false) // Does this make sense?
     {
       if (_outflows.size() != 8) {
         throw Exception("Axis2D outflow containers must have exactly 8 elements");
@@ -120,6 +120,21 @@ namespace YODA {
       return _ny;
     }
 
+    /// The bin lookup structures, shared with other axes of the same binning
+    const Utils::Binning::Ptr& binning() const {
+      return _binning;
+    }
+
+    /// Heap memory used by the bins, outflows and lookup structures
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn;
+      rtn.bins = Utils::heapSize(_bins) + Utils::heapSize(_outflows);
+      for (const Outflow& of : _outflows) rtn.bins += Utils::heapSize(of);
+      // The binning is shared, so only this axis's share of it is counted
+      rtn.index = (Utils::SHARED_PTR_OVERHEAD + sizeof(Utils::Binning) + _binning->heapSize()) / _binning.use_count();
+      return rtn;
+    }
+
     //@}
     //
     /// @name Statistics accessor functions
@@ -237,18 +252,18 @@ namespace YODA {
     void eraseBins(const std::pair<double, double>& xrange,
                    const std::pair<double, double>& yrange)
     {
-      size_t xiLow = _binSearcherX.index(xrange.first) - 1;
-      size_t xiHigh = _binSearcherX.index(xrange.second) - 1;
+      size_t xiLow = _binning->xSearcher().index(xrange.first) - 1;
+      size_t xiHigh = _binning->xSearcher().index(xrange.second) - 1;
 
-      size_t yiLow = _binSearcherY.index(yrange.first) - 1;
-      size_t yiHigh = _binSearcherY.index(yrange.second) - 1;
+      size_t yiLow = _binning->ySearcher().index(yrange.first) - 1;
+      size_t yiHigh = _binning->ySearcher().index(yrange.second) - 1;
 
       /// @todo Beware the specialisation problems with vector<bool>...
       std::vector<bool> deleteMask(numBins(), false);
 
       for (size_t yi = yiLow; yi < yiHigh; yi++) {
         for (size_t xi = xiLow; xi < xiHigh; xi++) {
-          ssize_t i = _indexes[_index(_nx, xi, yi)];
+          ssize_t i = _binning->indexes()[_index(_nx, xi, yi)];
           if (i == -1 || deleteMask[i]) continue;
           if (bin(i).fitsInside(xrange, yrange)) deleteMask[i] = true;
         }
@@ -340,7 +355,7 @@ namespace YODA {
     /// @note This only returns the finite edges, i.e. -inf and +inf are removed
     /// @todo Make the +-inf stripping controllable by a default-valued bool arg
     std::vector<double> xEdges() const {
-      std::vector<double> rtn(_binSearcherX.edges().begin()+1, _binSearcherX.edges().end()-1);
+      std::vector<double> rtn(_binning->xSearcher().edges().begin()+1, _binning->xSearcher().edges().end()-1);
       return rtn;
     }
 
@@ -349,7 +364,7 @@ namespace YODA {
     /// @note This only returns the finite edges, i.e. -inf and +inf are removed
     /// @todo Make the +-inf stripping controllable by a default-valued bool arg
     std::vector<double> yEdges() const {
-      std::vector<double> rtn(_binSearcherY.edges().begin()+1, _binSearcherY.edges().end()-1);
+      std::vector<double> rtn(_binning->ySearcher().edges().begin()+1, _binning->ySearcher().edges().end()-1);
       return rtn;
     }
 
@@ -374,11 +389,10 @@ namespace YODA {
     void addBins(const Bins& bins) {
       if (bins.size() == 0) return;
       _checkUnlocked();
-      Bins newBins = _bins;
-      /// @todo Reinstate when C++11 allowed in API
-      // for (const Bin& b : bins)
-      //   newBins.push_back(b);
-      for (size_t ib = 0; ib < bins.size(); ++ib) newBins.push_back(bins[ib]);
+      Bins newBins;
+      newBins.reserve(_bins.size() + bins.size());
+      newBins.insert(newBins.end(), _bins.begin(), _bins.end());
+      newBins.insert(newBins.end(), bins.begin(), bins.end());
       _updateAxis(newBins);
     }
 
@@ -414,12 +428,12 @@ namespace YODA {
 
     /// Get the bin index of the bin containing point (x, y).
     int binIndexAt(double x, double y) const {
-      size_t xi = _binSearcherX.index(x) - 1;
-      size_t yi = _binSearcherY.index(y) - 1;
+      size_t xi = _binning->xSearcher().index(x) - 1;
+      size_t yi = _binning->ySearcher().index(y) - 1;
       if (xi > _nx) return -1;
       if (yi > _ny) return -1;
 
-      return _indexes[_index(_nx, xi, yi)];
+      return _binning->indexes()[_index(_nx, xi, yi)];
     }
 
     /// Get the bin containing point (x, y).
@@ -468,6 +482,8 @@ namespace YODA {
     // rarely, isn't there a real case for having a "binningsCompatible" or
     // similar method?)
     bool operator == (const Axis2D& other) const {
+      // Identical binnings share a Binning, so this is the usual answer
+      if (_binning == other._binning) return true;
       if (numBins() != other.numBins()) return false;
       for (size_t i = 0; i < numBins(); i++)
         if (!(fuzzyEquals(bin(i).xMin(), other.bin(i).xMin()) &&
@@ -530,8 +546,7 @@ namespace YODA {
     void _updateAxis(Bins& bins) {
       // Deal with the case that there are no bins supplied (who called that?!)
       if (bins.size() == 0) {
-        _binSearcherX = Utils::BinSearcher();
-        _binSearcherY = Utils::BinSearcher();
+        _binning = Utils::Binning::empty();
         _nx = 0;
         _ny = 0;
         _xRange = std::make_pair(0, 0);
@@ -573,11 +588,11 @@ namespace YODA {
       assert(bins.size() <= (nx-1)*(ny-1) && "Input bins vector size must agree with computed number of unique bins");
 
       // Create a sea of indices, starting with an all-gaps configuration
-      std::vector<ssize_t> indexes(N, -1);
+      std::vector<long> indexes(N, -1);
 
       // Iterate through bins and find out which
-      Utils::BinSearcher xSearcher(xedges);
-      Utils::BinSearcher ySearcher(yedges);
+      const Utils::BinSearcher xSearcher(xedges);
+      const Utils::BinSearcher ySearcher(yedges);
       for (size_t i = 0; i < bins.size(); ++i) {
         Bin& bin = bins[i];
 
@@ -616,11 +631,8 @@ namespace YODA {
       _xRange = std::make_pair(xedges.front(), xedges.back());
       _yRange = std::make_pair(yedges.front(), yedges.back());
 
-      _indexes = indexes;
-      _bins = bins;
-
-      _binSearcherX = xSearcher;
-      _binSearcherY = ySearcher;
+      _binning = Utils::Binning::get(xedges, yedges, indexes);
+      _bins.swap(bins);
     }
 
 
@@ -659,16 +671,12 @@ namespace YODA {
     // Outflows
     Outflows _outflows;
 
-    // Binsearcher, for searching bins
-    Utils::BinSearcher _binSearcherX;
-    Utils::BinSearcher _binSearcherY;
+    // Bin searchers, and mapping from their indices to bin indices (allowing gaps), shared between axes
+    Utils::Binning::Ptr _binning;
 
     EdgePair1D _xRange;
     EdgePair1D _yRange;
 
-    // Mapping from bin-searcher indices to bin indices (allowing gaps)
-    std::vector<ssize_t> _indexes;
-
     // Necessary for bounds checking and indexing
     size_t _nx;
     size_t _ny;
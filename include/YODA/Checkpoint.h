@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_Checkpoint_h
+#define YODA_Checkpoint_h
+
+#include "YODA/AnalysisObject.h"
+#include "YODA/Writer.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <memory>
+
+namespace YODA {
+
+
+  /// @brief Writer of periodic snapshots of a set of objects to one growing file
+  ///
+  /// The first checkpoint writes all the objects. Each later one appends only
+  /// the objects which are new or whose contents have changed since the
+  /// previous checkpoint, so that the file holds the full history of changes
+  /// and the latest version of each object is its last occurrence. Use
+  /// readCheckpoint() to get the latest state back, and compactCheckpoint() to
+  /// rewrite the file with only that state.
+  ///
+  /// Changes are found by comparing a hash of each object's binary encoding,
+  /// cf. serialize(), which is much cheaper than formatting it as text. Objects
+  /// which are removed from the set are not removed from the file.
+  ///
+  /// The format, and compression, are chosen from the filename as in mkWriter.
+  class CheckpointWriter {
+  public:
+
+    /// Make a writer to @a filename, which is overwritten by the first checkpoint
+    CheckpointWriter(const std::string& filename, const WriterOptions& opts=WriterOptions());
+
+    /// @brief Write a checkpoint of @a aos, returning the number of objects written
+    ///
+    /// Each checkpoint is formatted in memory and appended to the file in one
+    /// go, and the file is closed again after each.
+    size_t write(const std::vector<const AnalysisObject*>& aos);
+
+    /// Write a checkpoint of a collection of pointer-like objects @a aos
+    template <typename RANGE>
+    typename std::enable_if<CIterable<RANGE>::value, size_t>::type
+    write(const RANGE& aos) {
+      std::vector<const AnalysisObject*> vec;
+      for (const auto& ao : aos) vec.push_back(&(*ao));
+      return write(vec);
+    }
+
+    /// Forget the state of the previous checkpoints, so that the next rewrites the file in full
+    void reset();
+
+    /// Number of checkpoints written
+    size_t numCheckpoints() const { return _numCheckpoints; }
+
+    /// Name of the file written to
+    const std::string& filename() const { return _filename; }
+
+
+  private:
+
+    std::string _filename;
+    std::unique_ptr<Writer> _writer;
+
+    /// Content hash of each object's path, at the last checkpoint
+    std::unordered_map<std::string, size_t> _hashes;
+
+    size_t _numCheckpoints = 0;
+
+  };
+
+
+  /// @brief Read the latest state of the objects in checkpoint file @a filename
+  ///
+  /// Only the last occurrence of each path is kept, in the order of first
+  /// appearance. The returned objects are owned by the caller.
+  std::vector<AnalysisObject*> readCheckpoint(const std::string& filename);
+
+  /// @brief Rewrite checkpoint file @a filename with only the latest state of each object
+  ///
+  /// The result is written to @a outfile if given, otherwise it replaces the
+  /// original file once complete. Returns the number of objects written.
+  size_t compactCheckpoint(const std::string& filename, const std::string& outfile="");
+
+
+}
+
+#endif
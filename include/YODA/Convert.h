@@ -0,0 +1,67 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_Convert_h
+#define YODA_Convert_h
+
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace YODA {
+
+
+  /// Settings for converting a batch of data files with convert()
+  struct ConvertOptions {
+
+    /// Format of the inputs, e.g. "yoda" or "aida", or empty to identify each from its filename
+    std::string inFormat;
+
+    /// Format of the outputs, e.g. "yoda" or "flat", or empty to identify each from its filename
+    std::string outFormat;
+
+    /// Only write objects whose paths match this regex (if not empty)
+    std::string match;
+
+    /// Don't write objects whose paths match this regex (if not empty)
+    std::string unmatch;
+
+    /// Write every object as its scatter representation
+    bool asScatters = false;
+
+    /// Number of worker threads, 0 for one per core (never more than the number of files)
+    size_t nthreads = 0;
+
+  };
+
+
+  /// What happened in the conversion of one file
+  struct ConvertStats {
+    std::string infile, outfile;
+    size_t numObjects = 0; ///< number of objects written
+    size_t inBytes = 0;    ///< size of the input file, 0 for stdin
+    size_t outBytes = 0;   ///< size of the output file, 0 for stdout
+    double seconds = 0;    ///< wall-clock time taken to read, convert and write
+    std::string error;     ///< message of the exception which stopped the conversion, if any
+  };
+
+
+  /// @brief Convert each of a list of (input, output) files
+  ///
+  /// Each worker thread takes the next file from the list, reads it, filters
+  /// and converts its objects, writes them out and frees them before moving on,
+  /// so only as many files as there are threads are held in memory at once.
+  /// Compressed outputs are chosen by a .gz filename extension, as in mkWriter.
+  ///
+  /// A failure in one file's conversion is recorded in its ConvertStats
+  /// rather than thrown, and the other files are still converted. The results
+  /// are in the order of @a inout.
+  std::vector<ConvertStats> convert(const std::vector< std::pair<std::string,std::string> >& inout,
+                                    const ConvertOptions& opts=ConvertOptions());
+
+
+}
+
+#endif
@@ -86,6 +86,13 @@ namespace YODA {
     /// Fill dimension of this data object
     size_t dim() const { return 0; }
 
+    /// Memory used by this object, which is all in the object and its annotations
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -0,0 +1,91 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_CovarianceMatrix_h
+#define YODA_CovarianceMatrix_h
+
+#include <vector>
+#include <cstddef>
+
+namespace YODA {
+
+
+  /// @brief Dense symmetric covariance matrix with contiguous row-major storage
+  ///
+  /// Element (i,j) lives at data()[i*size() + j], so the whole matrix can be
+  /// handed to numerical libraries (or NumPy) without any reshuffling.
+  class CovarianceMatrix {
+  public:
+
+    /// @name Constructors
+    //@{
+
+    /// Zero matrix of dimension @a n x @a n
+    CovarianceMatrix(size_t n=0)
+      : _n(n), _data(n*n, 0.0)
+    {  }
+
+    //@}
+
+
+    /// @name Accessors
+    //@{
+
+    /// Number of rows (and columns)
+    size_t size() const { return _n; }
+
+    /// Element (i,j)
+    double operator () (size_t i, size_t j) const { return _data[i*_n + j]; }
+
+    /// Element (i,j) (non-const)
+    double& operator () (size_t i, size_t j) { return _data[i*_n + j]; }
+
+    /// The contiguous row-major storage
+    const std::vector<double>& data() const { return _data; }
+
+    /// Copy into a vector of row vectors
+    std::vector<std::vector<double> > asVectors() const;
+
+    //@}
+
+
+    /// @name Accumulation
+    //@{
+
+    /// @brief Add the outer products e_k e_k^T for each row of @a errs
+    ///
+    /// @a errs is a row-major [nvars][size()] array of error vectors. The
+    /// symmetric rank-k update is done in cache-sized tiles of the upper
+    /// triangle, shared out between @a nthreads worker threads (0 picks a
+    /// number based on the available cores and the amount of work).
+    void addOuterProducts(const std::vector<double>& errs, size_t nvars, size_t nthreads=0);
+
+    /// Add the squares of each row of the row-major [nvars][size()] array @a errs to the diagonal
+    void addDiagonal(const std::vector<double>& errs, size_t nvars);
+
+    /// Element-wise addition
+    CovarianceMatrix& operator += (const CovarianceMatrix& other);
+
+    //@}
+
+
+  private:
+
+    size_t _n;
+    std::vector<double> _data;
+
+  };
+
+
+  /// Covariance matrix split into its bin-to-bin correlated and uncorrelated parts
+  struct CovarianceSplit {
+    CovarianceSplit(size_t n=0) : total(n), correlated(n), uncorrelated(n) {  }
+    CovarianceMatrix total, correlated, uncorrelated;
+  };
+
+
+}
+
+#endif
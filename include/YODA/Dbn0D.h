@@ -9,6 +9,7 @@
 #include "YODA/Exceptions.h"
 #include "YODA/Utils/MathUtils.h"
 #include <cmath>
+#include <cstddef>
 
 namespace YODA {
 
@@ -124,6 +125,17 @@ namespace YODA {
       return _sumW2;
     }
 
+    /// @brief Direct access to the contiguous running sums: numEntries, sumW, sumW2
+    ///
+    /// For zero-copy, strided array views across many distributions, e.g. all
+    /// the bins of a histogram. Writing through it bypasses fill().
+    double* sumsPtr() {
+      static_assert(offsetof(Dbn0D, _sumW2) == 2*sizeof(double), "Dbn0D sums must be contiguous");
+      return &_numEntries;
+    }
+    /// Direct access to the contiguous running sums (const version)
+    const double* sumsPtr() const { return &_numEntries; }
+
     //@}
 
 
@@ -168,6 +168,16 @@ namespace YODA {
       return _sumWX2;
     }
 
+    /// @brief Direct access to the contiguous running sums
+    ///
+    /// The layout is that of Dbn0D::sumsPtr(), followed by sumWX and sumWX2.
+    double* sumsPtr() {
+      static_assert(offsetof(Dbn1D, _sumWX2) == 4*sizeof(double), "Dbn1D sums must be contiguous");
+      return _dbnW.sumsPtr();
+    }
+    /// Direct access to the contiguous running sums (const version)
+    const double* sumsPtr() const { return _dbnW.sumsPtr(); }
+
     //@}
 
 
@@ -207,6 +207,18 @@ namespace YODA {
       return _sumWXY;
     }
 
+    /// @brief Direct access to the contiguous running sums
+    ///
+    /// The layout is the x and then the y Dbn1D::sumsPtr() blocks, followed by sumWXY.
+    /// Each block holds its own copy of numEntries, sumW and sumW2, so writes
+    /// to those must be made to every copy.
+    double* sumsPtr() {
+      static_assert(offsetof(Dbn2D, _sumWXY) == 10*sizeof(double), "Dbn2D sums must be contiguous");
+      return _dbnX.sumsPtr();
+    }
+    /// Direct access to the contiguous running sums (const version)
+    const double* sumsPtr() const { return _dbnX.sumsPtr(); }
+
     //@}
 
 
@@ -295,6 +295,18 @@ namespace YODA {
       return _sumWXZ;
     }
 
+    /// @brief Direct access to the contiguous running sums
+    ///
+    /// The layout is the x, y and z Dbn1D::sumsPtr() blocks, followed by sumWXY, sumWXZ and sumWYZ.
+    /// Each block holds its own copy of numEntries, sumW and sumW2, so writes
+    /// to those must be made to every copy.
+    double* sumsPtr() {
+      static_assert(offsetof(Dbn3D, _sumWYZ) == 17*sizeof(double), "Dbn3D sums must be contiguous");
+      return _dbnX.sumsPtr();
+    }
+    /// Direct access to the contiguous running sums (const version)
+    const double* sumsPtr() const { return _dbnX.sumsPtr(); }
+
     //@}
 
 
@@ -0,0 +1,40 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_FillText_h
+#define YODA_FillText_h
+
+#include "YODA/AnalysisObject.h"
+#include <iostream>
+#include <string>
+
+namespace YODA {
+
+
+  /// @brief Fill a histogram or profile from rows of numbers in a text stream
+  ///
+  /// Each row holds the fill coordinates of @a ao -- x for a Histo1D; x, y
+  /// for a Histo2D or Profile1D; x, y, z for a Profile2D -- optionally
+  /// followed by a fill weight, separated by whitespace and/or commas. Blank
+  /// lines are skipped, as is anything after a #. Compressed streams are
+  /// handled as by the readers.
+  ///
+  /// The input is read in large blocks, whose rows are parsed and filled by
+  /// @a nthreads threads (0 for one per core). Each extra thread fills an
+  /// empty copy of @a ao, which is added to it at the end, so the sums may
+  /// differ from a serial fill in the last few bits.
+  ///
+  /// Returns the number of rows filled. A ReadError is thrown for a row with
+  /// the wrong number of values or a non-numeric one, in which case @a ao is
+  /// left partly filled.
+  size_t fillFromText(AnalysisObject& ao, std::istream& stream, size_t nthreads=1);
+
+  /// Fill a histogram or profile from rows of numbers in file @a filename, or stdin if it is "-"
+  size_t fillFromText(AnalysisObject& ao, const std::string& filename, size_t nthreads=1);
+
+
+}
+
+#endif
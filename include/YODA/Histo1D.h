@@ -121,6 +121,14 @@ namespace YODA {
     /// Fill dimension of this data object
     size_t dim() const { return 1; }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn += _axis.memoryUsage();
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -201,7 +209,7 @@ namespace YODA {
     double xMax() const { return _axis.xMax(); }
 
     /// check if binning is the same as different Histo1D
-    bool sameBinning(const Histo1D& h1) {
+    bool sameBinning(const Histo1D& h1) const {
       return _axis == h1._axis;
     }
 
@@ -297,6 +305,9 @@ namespace YODA {
     /// value. To include the underflow and overflow areas, you should add them
     /// explicitly with the underflow() and overflow() methods.
     ///
+    /// For many queries on an unchanging histogram, a Histo1DIntegrals
+    /// snapshot answers each in constant time.
+    ///
     /// @todo Allow int bin index args for type compatibility with binIndexAt()?
     double integralRange(size_t binindex1, size_t binindex2) const {
       assert(binindex2 >= binindex1);
@@ -124,6 +124,14 @@ namespace YODA {
     /// Fill dimension of this data object
     size_t dim() const { return 2; }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn += _axis.memoryUsage();
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -270,7 +278,7 @@ namespace YODA {
 
 
     /// check if binning is the same as different Histo2D
-    bool sameBinning(const Histo2D& h2) {
+    bool sameBinning(const Histo2D& h2) const {
       return _axis == h2._axis;
     }
 
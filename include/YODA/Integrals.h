@@ -0,0 +1,113 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_Integrals_h
+#define YODA_Integrals_h
+
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include <vector>
+
+namespace YODA {
+
+
+  /// @brief Snapshot of a Histo1D's cumulative bin sums, for constant-time integrals
+  ///
+  /// Built in one pass over the bins, after which integralRange() and
+  /// integralTo() take constant time rather than looping over the bins as
+  /// the Histo1D methods of the same names do. The snapshot copies what it
+  /// needs, so later changes to the histogram are not seen: make a new one
+  /// to include them.
+  class Histo1DIntegrals {
+  public:
+
+    /// Take the cumulative sums of @a h
+    explicit Histo1DIntegrals(const Histo1D& h);
+
+    /// Number of bins
+    size_t numBins() const { return _cumsumw.size() - 1; }
+
+    /// @brief Integrated area between bins @a binindex1 and @a binindex2, inclusive
+    ///
+    /// As Histo1D::integralRange, up to rounding.
+    double integralRange(size_t binindex1, size_t binindex2) const {
+      assert(binindex2 >= binindex1);
+      if (binindex1 >= numBins()) throw RangeError("binindex1 is out of range");
+      if (binindex2 >= numBins()) throw RangeError("binindex2 is out of range");
+      return _cumsumw[binindex2+1] - _cumsumw[binindex1];
+    }
+
+    /// @brief Integrated area up to bin @a binindex, inclusive
+    ///
+    /// As Histo1D::integralTo.
+    double integralTo(size_t binindex, bool includeunderflow=true) const {
+      if (binindex >= numBins()) throw RangeError("binindex is out of range");
+      return (includeunderflow ? _underflow : 0) + _cumsumw[binindex+1];
+    }
+
+    /// Integrated area of all the bins
+    double integral() const { return _cumsumw.back(); }
+
+  private:
+
+    /// Sum of weights of the bins before each index, and of all of them
+    std::vector<double> _cumsumw;
+
+    double _underflow;
+
+  };
+
+
+  /// @brief Snapshot of a Histo2D's summed-area table, for constant-time integrals
+  ///
+  /// Integrals are over the cells of the grid of x and y bin edges,
+  /// numCellsX() by numCellsY() of them, which are the bins themselves for
+  /// a regular binning. A bin spanning several cells is counted in its
+  /// lowest-x, lowest-y one. As for Histo1DIntegrals, later changes to the
+  /// histogram are not seen.
+  class Histo2DIntegrals {
+  public:
+
+    /// Build the summed-area table of @a h
+    explicit Histo2DIntegrals(const Histo2D& h);
+
+    /// Number of cells along x
+    size_t numCellsX() const { return _ncx; }
+
+    /// Number of cells along y
+    size_t numCellsY() const { return _ncy; }
+
+    /// Integrated volume of the cells @a ixlow..@a ixhigh and @a iylow..@a iyhigh, inclusive
+    double integralRange(size_t ixlow, size_t ixhigh, size_t iylow, size_t iyhigh) const {
+      assert(ixhigh >= ixlow && iyhigh >= iylow);
+      if (ixhigh >= _ncx) throw RangeError("ixhigh is out of range");
+      if (iyhigh >= _ncy) throw RangeError("iyhigh is out of range");
+      return _sat(ixhigh+1, iyhigh+1) - _sat(ixlow, iyhigh+1) - _sat(ixhigh+1, iylow) + _sat(ixlow, iylow);
+    }
+
+    /// Integrated volume of the cells up to and including cell (@a ix, @a iy)
+    double integralTo(size_t ix, size_t iy) const {
+      return integralRange(0, ix, 0, iy);
+    }
+
+    /// Integrated volume of all the bins
+    double integral() const { return _table.back(); }
+
+  private:
+
+    /// Sum over the cells below and left of corner (@a ix, @a iy)
+    double _sat(size_t ix, size_t iy) const { return _table[iy*(_ncx+1) + ix]; }
+
+    size_t _ncx, _ncy;
+
+    /// Summed-area table, with a leading row and column of zeros
+    std::vector<double> _table;
+
+  };
+
+
+}
+
+#endif
@@ -0,0 +1,137 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_LiveExport_h
+#define YODA_LiveExport_h
+
+#include "YODA/AnalysisObject.h"
+#include "YODA/Utils/Traits.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace YODA {
+
+
+  /// @brief Publisher of a set of objects' current state in a POSIX shared-memory segment
+  ///
+  /// Each object has its own slot in the segment, holding its binary encoding
+  /// (cf. serialize()) and a sequence number which is odd while the slot is
+  /// being rewritten. update() copies the objects into their slots, and is to
+  /// be called by the thread which fills them, at whatever rate suits: it
+  /// never waits for readers. A LiveReader in any process on the same machine
+  /// can then take consistent snapshots of the objects without locking, by
+  /// retrying the copy of any slot which changed while it was read.
+  ///
+  /// The objects are referred to, not copied, so must outlive the exporter.
+  /// The set of objects is fixed, but each slot has room for its object's
+  /// encoding to grow, e.g. by a changed annotation. The segment is removed
+  /// when the exporter is destroyed.
+  class LiveExport {
+  public:
+
+    /// @brief Create segment @a name for the objects @a aos and publish them
+    ///
+    /// A leading slash is added to @a name if missing. Any existing segment
+    /// of the same name is unlinked first: readers of it are unaffected, but
+    /// will see no more updates.
+    LiveExport(const std::string& name, const std::vector<const AnalysisObject*>& aos);
+
+    /// Create segment @a name for a collection of pointer-like objects @a aos
+    template <typename RANGE, typename = typename std::enable_if<CIterable<RANGE>::value>::type>
+    LiveExport(const std::string& name, const RANGE& aos)
+      : LiveExport(name, _ptrs(aos))
+    {  }
+
+    /// Unmaps and unlinks the segment
+    ~LiveExport();
+
+    LiveExport(const LiveExport&) = delete;
+    LiveExport& operator = (const LiveExport&) = delete;
+
+    /// @brief Publish the current state of all the objects
+    ///
+    /// A WriteError is thrown if an object's encoding has outgrown its slot.
+    void update();
+
+    /// Segment name, with its leading slash
+    const std::string& name() const { return _name; }
+
+    /// Number of objects exported
+    size_t numObjects() const { return _aos.size(); }
+
+    /// Size of the segment in bytes
+    size_t size() const { return _size; }
+
+
+  private:
+
+    template <typename RANGE>
+    static std::vector<const AnalysisObject*> _ptrs(const RANGE& aos) {
+      std::vector<const AnalysisObject*> rtn;
+      for (const auto& ao : aos) rtn.push_back(&(*ao));
+      return rtn;
+    }
+
+    std::string _name;
+    std::vector<const AnalysisObject*> _aos;
+    char* _mem = nullptr;
+    size_t _size = 0;
+
+  };
+
+
+  /// @brief Reader of the objects published by a LiveExport, possibly in another process
+  ///
+  /// Snapshots are consistent per object: each one is a state of the object
+  /// as passed to a single LiveExport::update(). A snapshot of all the objects
+  /// may combine states from consecutive updates.
+  class LiveReader {
+  public:
+
+    /// Map segment @a name for reading, adding a leading slash if missing
+    explicit LiveReader(const std::string& name);
+
+    /// Unmaps the segment
+    ~LiveReader();
+
+    LiveReader(const LiveReader&) = delete;
+    LiveReader& operator = (const LiveReader&) = delete;
+
+    /// Number of objects in the segment
+    size_t numObjects() const;
+
+    /// Path of object @a i
+    std::string path(size_t i) const;
+
+    /// Number of completed LiveExport::update() calls
+    uint64_t numUpdates() const;
+
+    /// @brief A consistent copy of object @a i, owned by the caller
+    ///
+    /// A ReadError is thrown if the slot is still being written after a
+    /// second, e.g. because the exporting process died mid-update.
+    AnalysisObject* snapshot(size_t i) const;
+
+    /// Consistent copies of all the objects, owned by the caller
+    std::vector<AnalysisObject*> snapshot() const;
+
+
+  private:
+
+    std::string _name;
+    const char* _mem = nullptr;
+    size_t _size = 0;
+
+  };
+
+
+  /// Read a snapshot of the objects published to shared-memory segment @a name
+  std::vector<AnalysisObject*> readLive(const std::string& name);
+
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_Merge_h
+#define YODA_Merge_h
+
+#include "YODA/AnalysisObject.h"
+#include <string>
+#include <vector>
+#include <utility>
+
+namespace YODA {
+
+
+  /// Settings for merging analysis objects with the same path from several runs
+  struct MergeOptions {
+
+    /// Strategies for combining scatters, which don't carry enough statistics to be merged exactly
+    enum ScatterMode {
+      SCATTER_FIRST,       ///< Keep the first copy unchanged
+      SCATTER_COMBINE,     ///< Collect the points of all copies into one scatter
+      SCATTER_ASSUME_MEAN, ///< Scale-weighted mean of the values, errors added in quadrature
+      SCATTER_ADD          ///< Scale-weighted sum of the values, errors added in quadrature
+    };
+
+    /// Treatment of Scatter1D objects
+    ScatterMode s1dMode = SCATTER_ASSUME_MEAN;
+    /// Treatment of Scatter2D objects
+    ScatterMode s2dMode = SCATTER_ASSUME_MEAN;
+    /// Treatment of Scatter3D objects
+    ScatterMode s3dMode = SCATTER_ASSUME_MEAN;
+
+    /// Convert copies with mismatched types to scatters and merge those (otherwise keep the first)
+    bool mismatchToScatter = true;
+
+    /// Simple stacking: ignore the ScaledBy normalisation heuristic and add all scatters
+    bool stack = false;
+
+    /// Drop empty (sumW = 0) fillable objects before applying the merge heuristics
+    bool vetoEmpty = true;
+
+    /// Number of worker threads, 0 for one per core (never more than the number of inputs)
+    size_t nthreads = 0;
+
+  };
+
+
+  /// Get the scatter merge mode called @a name: "first", "combine", "assume_mean" or "add"
+  MergeOptions::ScatterMode mkScatterMergeMode(const std::string& name);
+
+
+  /// @brief Merge the analysis objects from a set of files, each with a weight scale factor
+  ///
+  /// Objects with the same path are combined with the same rules as the
+  /// yodamerge script. If every (non-empty) input copy of a histogram, profile
+  /// or counter has a ScaledBy annotation, the copies are treated as normalised:
+  /// the normalisation is undone before the per-file scaling and adding, and the
+  /// result is re-normalised to the scale-weighted average. Otherwise, the scaled
+  /// copies are just added. Scatters are treated according to the MergeOptions
+  /// modes for their dimension.
+  ///
+  /// The files are read in parallel, each worker streaming through its share of
+  /// the inputs and keeping only one running accumulator per path. The workers'
+  /// results are then combined in a pairwise tree reduction, so the peak memory
+  /// use is set by the number of threads rather than the number of inputs. The
+  /// few paths whose treatment can only be decided after seeing every input
+  /// (mixed normalisation, or mismatched types) are merged again in a second pass.
+  ///
+  /// Warnings are written to std::cerr. The returned objects are owned by the
+  /// caller, ordered by their first appearance in the inputs.
+  std::vector<AnalysisObject*> merge(const std::vector< std::pair<std::string,double> >& inputs,
+                                     const MergeOptions& opts=MergeOptions());
+
+
+}
+
+#endif
@@ -7,6 +7,10 @@
 #define YODA_POINT_H
 
 #include "YODA/AnalysisObject.h"
+#include "YODA/Utils/VariationTable.h"
+#include <memory>
+#include <vector>
+#include <map>
 
 namespace YODA {
 
@@ -16,7 +20,10 @@ namespace YODA {
   public:
 
     typedef std::pair<double,double> ValuePair;
-    
+
+    /// Shared table of variation names, indexing the per-point error breakdown
+    typedef std::shared_ptr<Utils::VariationTable> VariationTablePtr;
+
 
     /// Virtual destructor for inheritance
     virtual ~Point() {};
@@ -24,11 +31,24 @@ namespace YODA {
     /// Space dimension of the point
     virtual size_t dim() = 0;
     
-    //get the error map for the highest dimension
-    virtual const std::map< std::string, std::pair<double,double>> & errMap() const =0;
-    
-    //Parse the annotation from the parent AO which contains any variations
-    virtual void getVariationsFromParent() const =0;
+    /// @brief Get the error map for the highest dimension
+    ///
+    /// @note The map is built on the fly from the ID-indexed error storage: prefer
+    /// the variation-ID accessors in performance-sensitive loops.
+    virtual std::map< std::string, std::pair<double,double>> errMap() const {
+      getVariationsFromParent();
+      std::map< std::string, std::pair<double,double>> rtn;
+      for (size_t id = 0; id < _varset.size(); ++id) {
+        if (!_varset[id]) continue;
+        rtn[ id == 0 ? std::string() : _vartable->name(id) ] = _varerrs[id];
+      }
+      return rtn;
+    }
+
+    /// Parse any error-breakdown annotation held by the parent AO into its points
+    virtual void getVariationsFromParent() const {
+      if (_parentAO) _parentAO->parseVariations();
+    }
 
     /// Get the point value for direction @a i
     virtual double val(size_t i) const = 0;
@@ -90,7 +110,100 @@ namespace YODA {
     /// @todo void transform(size_t i, FN f) = 0;
 
     //@}
-    
+
+
+    /// @name Error breakdown by variation ID
+    ///
+    /// Errors on the highest dimension are stored contiguously, indexed by the
+    /// ID of their source in a VariationTable shared with the parent Scatter.
+    /// These accessors do not trigger parsing of the parent's ErrorBreakdown.
+    //@{
+
+    /// Get the variation table indexing this point's error breakdown (may be null)
+    const VariationTablePtr& variationTable() const {
+      return _vartable;
+    }
+
+    /// Heap bytes used by the error breakdown, excluding the shared variation table
+    size_t heapSize() const {
+      return Utils::heapSize(_varerrs) + Utils::heapSize(_varset);
+    }
+
+    /// Re-index this point's error breakdown against @a table, matching sources by name
+    void setVariationTable(const VariationTablePtr& table) {
+      if (table == _vartable) return;
+      if (_varset.size() <= 1) { _vartable = table; return; } //< only the nominal: no re-indexing needed
+      std::vector<std::pair<double,double>> newerrs;
+      std::vector<bool> newset;
+      for (size_t id = 0; id < _varset.size(); ++id) {
+        if (!_varset[id]) continue;
+        const size_t newid = (id == 0) ? 0 : table->intern(_vartable->name(id));
+        if (newid >= newset.size()) {
+          newerrs.resize(newid+1, std::make_pair(0.,0.));
+          newset.resize(newid+1, false);
+        }
+        newerrs[newid] = _varerrs[id];
+        newset[newid] = true;
+      }
+      _varerrs.swap(newerrs);
+      _varset.swap(newset);
+      _vartable = table;
+    }
+
+    /// @brief Re-index this point's error breakdown against @a table using a precomputed ID map
+    ///
+    /// @a idmap maps each ID in the current table to the corresponding ID in
+    /// @a table, e.g. as returned by VariationTable::intern(const VariationTable&):
+    /// useful to avoid repeating the name lookups for many points sharing a table.
+    void setVariationTable(const VariationTablePtr& table, const std::vector<size_t>& idmap) {
+      if (table == _vartable) return;
+      if (_varset.size() <= 1) { _vartable = table; return; }
+      std::vector<std::pair<double,double>> newerrs(table->size(), std::make_pair(0.,0.));
+      std::vector<bool> newset(table->size(), false);
+      for (size_t id = 0; id < _varset.size(); ++id) {
+        if (!_varset[id]) continue;
+        const size_t newid = idmap.at(id);
+        newerrs[newid] = _varerrs[id];
+        newset[newid] = true;
+      }
+      _varerrs.swap(newerrs);
+      _varset.swap(newset);
+      _vartable = table;
+    }
+
+    /// Number of variation-ID slots held by this point (set or not)
+    size_t numVariationSlots() const {
+      return _varset.size();
+    }
+
+    /// Does this point have an error for the variation with ID @a id?
+    bool hasVariation(size_t id) const {
+      return id < _varset.size() && _varset[id];
+    }
+
+    /// Get the error pair for the variation with ID @a id
+    const std::pair<double,double>& variationErrs(size_t id) const {
+      if (!hasVariation(id)) throw RangeError("Point has no error for this variation ID");
+      return _varerrs[id];
+    }
+
+    /// @brief Set the error pair for the variation with ID @a id
+    ///
+    /// The ID must be valid in this point's variation table (ID 0 always is).
+    void setVariationErrs(size_t id, const std::pair<double,double>& e) {
+      if (id > 0 && (!_vartable || id >= _vartable->size()))
+        throw RangeError("Variation ID is not registered in this point's variation table");
+      if (id >= _varset.size()) {
+        _varerrs.resize(id+1, std::make_pair(0.,0.));
+        _varset.resize(id+1, false);
+      }
+      _varerrs[id] = e;
+      _varset[id] = true;
+    }
+
+    //@}
+
+
     void setParentAO(AnalysisObject* parent){
       _parentAO=parent;
     }
@@ -99,10 +212,75 @@ namespace YODA {
       return _parentAO;
     }
     
+  protected:
+
+    /// @name Name-based helpers for the error breakdown
+    //@{
+
+    /// Copy the error breakdown of @a p, keeping this point's variation table if it has one
+    void _assignVarErrs(const Point& p) {
+      if (!_vartable || _vartable == p._vartable) {
+        _varerrs = p._varerrs;
+        _varset = p._varset;
+        _vartable = p._vartable;
+      } else {
+        const VariationTablePtr mytable = _vartable;
+        _varerrs = p._varerrs;
+        _varset = p._varset;
+        _vartable = p._vartable;
+        setVariationTable(mytable);
+      }
+    }
+
+    /// Look up the errors for @a source, throwing a RangeError labelled by @a label if missing
+    const std::pair<double,double>& _varErrs(const std::string& source, const char* label) const {
+      if (!source.empty()) getVariationsFromParent();
+      size_t id = 0;
+      if (!source.empty()) id = _vartable ? _vartable->find(source) : _varset.size();
+      if (!hasVariation(id)) throw RangeError(std::string(label) + " has no such key: " + source);
+      return _varerrs[id];
+    }
+
+    /// Get a writeable error pair for @a source, creating it as (0,0) if needed
+    std::pair<double,double>& _varErrsRef(const std::string& source) {
+      size_t id = 0;
+      if (!source.empty()) {
+        if (!_vartable) _vartable = std::make_shared<Utils::VariationTable>();
+        id = _vartable->intern(source);
+      }
+      if (id >= _varset.size()) {
+        _varerrs.resize(id+1, std::make_pair(0.,0.));
+        _varset.resize(id+1, false);
+      }
+      _varset[id] = true;
+      return _varerrs[id];
+    }
+
+    /// Scale all error-breakdown entries by @a scale
+    void _scaleVarErrs(double scale) {
+      for (std::pair<double,double>& e : _varerrs) {
+        e.first *= scale;
+        e.second *= scale;
+      }
+    }
+
+    //@}
+
+
   private:
+
     // pointer back to the parent AO which these points belong to.
     AnalysisObject* _parentAO=0;
-    
+
+    /// Errors for each variation, indexed by ID in _vartable. Nominal stored at 0
+    std::vector< std::pair<double,double> > _varerrs;
+
+    /// Flags for which variation IDs have been set on this point
+    std::vector<bool> _varset;
+
+    /// Name <-> ID table for the variations, normally shared with the parent Scatter
+    VariationTablePtr _vartable;
+
 
   };
 
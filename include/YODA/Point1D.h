@@ -29,7 +29,7 @@ namespace YODA {
     Point1D(double x, double ex=0.0, std::string source="")
       : _x(x)
     {
-      _ex[source] = std::make_pair(ex, ex);
+      _varErrsRef(source) = std::make_pair(ex, ex);
     }
 
 
@@ -37,7 +37,7 @@ namespace YODA {
     Point1D(double x, double exminus, double explus, std::string source="")
       : _x(x)
     {
-      _ex[source] = std::make_pair(exminus, explus);
+      _varErrsRef(source) = std::make_pair(exminus, explus);
     }
 
 
@@ -45,22 +45,20 @@ namespace YODA {
     Point1D(double x, const std::pair<double,double>& ex,  std::string source="")
       : _x(x)
     {
-      _ex[source] = ex;
+      _varErrsRef(source) = ex;
     }
 
 
     /// Copy constructor
     Point1D(const Point1D& p)
-      : _x(p._x), _ex(p._ex)
-    {  
-      this->setParentAO( p.getParentAO());
-    }
+      : Point(p), _x(p._x)
+    {  }
 
 
     /// Copy assignment
     Point1D& operator = (const Point1D& p) {
       _x = p._x;
-      _ex = p._ex;
+      _assignVarErrs(p);
       this->setParentAO( p.getParentAO());
       return *this;
     }
@@ -93,42 +91,33 @@ namespace YODA {
 
     /// Get x-error values
     const std::pair<double,double>& xErrs(  std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ex.count(source)) throw RangeError("xErrs has no such key: "+source);
-      return _ex.at(source);
+      return _varErrs(source, "xErrs");
     }
 
     /// Get negative x-error value
     double xErrMinus( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ex.count(source)) throw RangeError("xErrs has no such key: "+source);
-      return _ex.at(source).first;
+      return _varErrs(source, "xErrs").first;
     }
 
     /// Get positive x-error value
     double xErrPlus( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ex.count(source)) throw RangeError("xErrs has no such key: "+source);
-      return _ex.at(source).second;
+      return _varErrs(source, "xErrs").second;
     }
 
     /// Get average x-error value
     double xErrAvg( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ex.count(source)) throw RangeError("xErrs has no such key: "+source);
-      return (_ex.at(source).first + _ex.at(source).second)/2.0;
+      const std::pair<double,double>& ex = _varErrs(source, "xErrs");
+      return (ex.first + ex.second)/2.0;
     }
 
     /// Set negative x error
     void setXErrMinus(double exminus,  std::string source="") {
-      if (!_ex.count(source)) _ex[source] = std::make_pair(0.,0.);
-      _ex.at(source).first = exminus;
+      _varErrsRef(source).first = exminus;
     }
 
     /// Set positive x error
     void setXErrPlus(double explus,  std::string source="") {
-      if (!_ex.count(source)) _ex[source] = std::make_pair(0.,0.);
-      _ex.at(source).second = explus;
+      _varErrsRef(source).second = explus;
     }
 
     /// Set symmetric x error
@@ -150,21 +139,17 @@ namespace YODA {
 
     /// Set asymmetric x error
     void setXErrs(const std::pair<double,double>& ex,  std::string source="") {
-      _ex[source] = ex;
+      _varErrsRef(source) = ex;
     }
 
     /// Get value minus negative x-error
     double xMin(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ex.count(source)) throw RangeError("xErrs has no such key: "+source);
-      return _x - _ex.at(source).first;
+      return _x - _varErrs(source, "xErrs").first;
     }
 
     /// Get value plus positive x-error
     double xMax(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ex.count(source)) throw RangeError("xErrs has no such key: "+source);
-      return _x + _ex.at(source).second;
+      return _x + _varErrs(source, "xErrs").second;
     }
 
     //@}
@@ -200,9 +185,7 @@ namespace YODA {
     /// Scaling of x axis
     void scaleX(double scalex) {
       setX(x()*scalex);
-      for (const auto   &source : _ex){
-        setXErrs(xErrMinus()*scalex, xErrPlus()*scalex, source.first);
-      }
+      _scaleVarErrs(scalex);
     }
 
     //@}
@@ -221,15 +204,11 @@ namespace YODA {
       if (i != 1) throw RangeError("Invalid axis int, must be in range 1..dim");
       setX(val);
     }
-
-    /// Get error map for direction @a i
-    const std::map< std::string, std::pair<double,double>> & errMap() const {
-      getVariationsFromParent();
-      return _ex;
+    /// Direct access to the stored value for direction @a i, e.g. for zero-copy array views
+    double* valPtr(size_t i) {
+      if (i != 1) throw RangeError("Invalid axis int, must be in range 1..dim");
+      return &_x;
     }
-    
-    // Parse the variations from the parent AO if it exists
-    void getVariationsFromParent() const;
 
     /// Get error values for direction @a i
     const std::pair<double,double>& errs(size_t i, std::string source="") const {
@@ -304,9 +283,8 @@ namespace YODA {
     //@{
 
     double _x;
-    // a map of the errors for each source. Nominal stored under ""
-    // to ensure backward compatibility
-    std::map< std::string, std::pair<double,double> > _ex;
+    // the x errors for each source live in the Point base class, indexed
+    // by variation ID. Nominal stored under "" (ID 0) for backward compatibility
 
     //@}
 
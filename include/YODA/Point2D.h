@@ -31,7 +31,7 @@ namespace YODA {
       : _x(x), _y(y)
     {
       _ex = std::make_pair(ex, ex);
-      _ey[source] = std::make_pair(ey, ey);
+      _varErrsRef(source) = std::make_pair(ey, ey);
     }
 
 
@@ -44,7 +44,7 @@ namespace YODA {
       : _x(x), _y(y)
     {
       _ex = std::make_pair(exminus, explus);
-      _ey[source] = std::make_pair(eyminus, eyplus);
+      _varErrsRef(source) = std::make_pair(eyminus, eyplus);
     }
 
 
@@ -69,17 +69,15 @@ namespace YODA {
       : _x(x), _y(y)
     {
       _ex = ex;
-      _ey[source] = ey;
+      _varErrsRef(source) = ey;
     }
 
 
     /// Copy constructor
     Point2D(const Point2D& p)
-      : _x(p._x), _y(p._y)
+      : Point(p), _x(p._x), _y(p._y)
     {
       _ex = p._ex;
-      _ey = p._ey;
-      this->setParentAO( p.getParentAO());
     }
 
 
@@ -88,7 +86,7 @@ namespace YODA {
       _x = p._x;
       _y = p._y;
       _ex = p._ex;
-      _ey = p._ey;
+      _assignVarErrs(p);
       this->setParentAO( p.getParentAO());
       return *this;
     }
@@ -212,45 +210,34 @@ namespace YODA {
 
     /// Get y-error values
     const std::pair<double,double>& yErrs(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ey.count(source)) throw RangeError("yErrs has no such key: "+source);
-      return _ey.at(source);
+      return _varErrs(source, "yErrs");
     }
 
     /// Get negative y-error value
     double yErrMinus(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ey.count(source)) throw RangeError("yErrs has no such key: "+source);
-      return _ey.at(source).first;
+      return _varErrs(source, "yErrs").first;
     }
 
     /// Get positive y-error value
     double yErrPlus(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ey.count(source)) throw RangeError("yErrs has no such key: "+source);
-      return _ey.at(source).second;
+      return _varErrs(source, "yErrs").second;
     }
 
     /// Get average y-error value
     double yErrAvg(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ey.count(source)) throw RangeError("yErrs has no such key: "+source);
-      double res=(fabs(_ey.at(source).first) + fabs(_ey.at(source).second))/2.;
+      const std::pair<double,double>& ey = _varErrs(source, "yErrs");
+      double res=(fabs(ey.first) + fabs(ey.second))/2.;
       return res;
     }
 
     /// Set negative y error
     void setYErrMinus(double eyminus, std::string source="") {
-      if (!_ey.count(source)) {
-        _ey[source] = std::make_pair(0.,0.);
-      }
-      _ey.at(source).first = eyminus;
+      _varErrsRef(source).first = eyminus;
     }
 
     /// Set positive y error
     void setYErrPlus(double eyplus, std::string source="") {
-      if (!_ey.count(source)) _ey[source] = std::make_pair(0.,0.);
-      _ey.at(source).second = eyplus;
+      _varErrsRef(source).second = eyplus;
     }
 
     /// Set symmetric y error
@@ -266,27 +253,22 @@ namespace YODA {
 
     /// Set asymmetric y error
     void setYErrs(double eyminus, double eyplus, std::string source="") {
-      setYErrMinus(eyminus, source);
-      setYErrPlus(eyplus, source );
+      _varErrsRef(source) = std::make_pair(eyminus, eyplus);
     }
 
     /// Set asymmetric y error
     void setYErrs(const std::pair<double,double>& ey, std::string source="") {
-      _ey[source] = ey;
+      _varErrsRef(source) = ey;
     }
 
     /// Get value minus negative y-error
     double yMin(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ey.count(source)) throw RangeError("yErrs has no such key: "+source);
-      return _y - _ey.at(source).first;
+      return _y - _varErrs(source, "yErrs").first;
     }
 
     /// Get value plus positive y-error
     double yMax(std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ey.count(source)) throw RangeError("yErrs has no such key: "+source);
-      return _y + _ey.at(source).second;
+      return _y + _varErrs(source, "yErrs").second;
     }
 
     //@}
@@ -349,9 +331,7 @@ namespace YODA {
     /// Scaling of y axis
     void scaleY(double scaley) {
       setY(y()*scaley);
-      for (const auto   &source : _ey){
-        setYErrs(yErrMinus()*scaley, yErrPlus()*scaley, source.first);
-      }
+      _scaleVarErrs(scaley);
     }
 
     /// Scaling of both axes
@@ -388,12 +368,14 @@ namespace YODA {
       default: throw RangeError("Invalid axis int, must be in range 1..dim");
       }
     }
-
-    /// Get error map for direction @a i
-    const std::map< std::string, std::pair<double,double>> & errMap() const; 
-    
-    // Parse the variations from the parent AO if it exists
-    void getVariationsFromParent() const;
+    /// Direct access to the stored value for direction @a i, e.g. for zero-copy array views
+    double* valPtr(size_t i) {
+      switch (i) {
+      case 1: return &_x;
+      case 2: return &_y;
+      default: throw RangeError("Invalid axis int, must be in range 1..dim");
+      }
+    }
 
     /// Get error values for direction @a i
     const std::pair<double,double>& errs(size_t i, std::string source="") const {
@@ -508,9 +490,8 @@ namespace YODA {
     double _x;
     double _y;
     std::pair<double,double> _ex;
-    // a map of the errors for each source. Nominal stored under ""
-    // to ensure backward compatibility
-    std::map< std::string, std::pair<double,double> > _ey;
+    // the y errors for each source live in the Point base class, indexed
+    // by variation ID. Nominal stored under "" (ID 0) for backward compatibility
 
     //@}
 
@@ -31,7 +31,7 @@ namespace YODA {
     {
       _ex = std::make_pair(ex, ex);
       _ey = std::make_pair(ey, ey);
-      _ez[source] = std::make_pair(ez, ez);
+      _varErrsRef(source) = std::make_pair(ez, ez);
     }
 
 
@@ -47,7 +47,7 @@ namespace YODA {
     {
       _ex = std::make_pair(exminus, explus);
       _ey = std::make_pair(eyminus, eyplus);
-      _ez[source] = std::make_pair(ezminus, ezplus);
+      _varErrsRef(source) = std::make_pair(ezminus, ezplus);
     }
 
     /// Constructor from asymmetric errors given as vectors
@@ -58,17 +58,15 @@ namespace YODA {
       : _x(x), _y(y), _z(z),
         _ex(ex), _ey(ey)
     {
-      _ez[source] = ez;
+      _varErrsRef(source) = ez;
     }
 
 
     /// Copy constructor
     Point3D(const Point3D& p)
-      : _x(p._x), _y(p._y), _z(p._z),
-        _ex(p._ex), _ey(p._ey), _ez(p._ez)
-    {  
-      this->setParentAO( p.getParentAO());
-    }
+      : Point(p), _x(p._x), _y(p._y), _z(p._z),
+        _ex(p._ex), _ey(p._ey)
+    {  }
 
 
     /// Copy assignment
@@ -78,7 +76,7 @@ namespace YODA {
       _z = p._z;
       _ex = p._ex;
       _ey = p._ey;
-      _ez = p._ez;
+      _assignVarErrs(p);
       this->setParentAO( p.getParentAO());
       return *this;
     }
@@ -270,42 +268,33 @@ namespace YODA {
 
     /// Get z-error values
     const std::pair<double,double>& zErrs( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ez.count(source)) throw RangeError("zErrs has no such key: "+source);
-      return _ez.at(source);
+      return _varErrs(source, "zErrs");
     }
 
     /// Get negative z-error value
     double zErrMinus( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ez.count(source)) throw RangeError("zErrs has no such key: "+source);
-      return _ez.at(source).first;
+      return _varErrs(source, "zErrs").first;
     }
 
     /// Get positive z-error value
     double zErrPlus( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ez.count(source)) throw RangeError("zErrs has no such key: "+source);
-      return _ez.at(source).second;
+      return _varErrs(source, "zErrs").second;
     }
 
     /// Get average z-error value
     double zErrAvg( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ez.count(source)) throw RangeError("zErrs has no such key: "+source);
-      return (_ez.at(source).first + _ez.at(source).second)/2.0;
+      const std::pair<double,double>& ez = _varErrs(source, "zErrs");
+      return (ez.first + ez.second)/2.0;
     }
 
     /// Set negative z error
     void setZErrMinus(double ezminus,  std::string source="") {
-      if (!_ez.count(source)) _ez[source] = std::make_pair(0.,0.);
-      _ez.at(source).first = ezminus;
+      _varErrsRef(source).first = ezminus;
     }
 
     /// Set positive z error
     void setZErrPlus(double ezplus,  std::string source="") {
-      if (!_ez.count(source)) _ez[source] = std::make_pair(0.,0.);
-      _ez.at(source).second = ezplus;
+      _varErrsRef(source).second = ezplus;
     }
 
     /// Set symmetric z error
@@ -327,21 +316,17 @@ namespace YODA {
 
     /// Set asymmetric z error
     void setZErrs(const std::pair<double,double>& ez,  std::string source="") {
-      _ez[source] = ez;
+      _varErrsRef(source) = ez;
     }
 
     /// Get value minus negative z-error
     double zMin( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ez.count(source)) throw RangeError("zErrs has no such key: "+source);
-      return _z - _ez.at(source).first;
+      return _z - _varErrs(source, "zErrs").first;
     }
 
     /// Get value plus positive z-error
     double zMax( std::string source="") const {
-      if (source!="") getVariationsFromParent();
-      if (!_ez.count(source)) throw RangeError("zErrs has no such key: "+source);
-      return _z + _ez.at(source).second;
+      return _z + _varErrs(source, "zErrs").second;
     }
 
     //@}
@@ -427,9 +412,7 @@ namespace YODA {
     /// Scaling of z axis
     void scaleZ(double scalez) {
       setZ(z()*scalez);
-      for (const auto   &source : _ez){
-        setZErrs(zErrMinus()*scalez, zErrPlus()*scalez, source.first);
-      }
+      _scaleVarErrs(scalez);
     }
 
     /// Scaling of all three axes
@@ -469,15 +452,15 @@ namespace YODA {
       default: throw RangeError("Invalid axis int, must be in range 1..dim");
       }
     }
-
-    /// Get error map for direction @a i
-    const std::map< std::string, std::pair<double,double>> & errMap() const {
-      getVariationsFromParent();
-      return _ez;
+    /// Direct access to the stored value for direction @a i, e.g. for zero-copy array views
+    double* valPtr(size_t i) {
+      switch (i) {
+      case 1: return &_x;
+      case 2: return &_y;
+      case 3: return &_z;
+      default: throw RangeError("Invalid axis int, must be in range 1..dim");
+      }
     }
-    
-    // Parse the variations from the parent AO if it exists
-    void getVariationsFromParent() const;
 
     /// Get error values for direction @a i
     const std::pair<double,double>& errs(size_t i,  std::string source="") const {
@@ -604,9 +587,8 @@ namespace YODA {
     double _z;
     std::pair<double,double> _ex;
     std::pair<double,double> _ey;
-    // a map of the errors for each source. Nominal stored under ""
-    // to ensure backward compatibility
-    std::map< std::string, std::pair<double,double> >_ez;
+    // the z errors for each source live in the Point base class, indexed
+    // by variation ID. Nominal stored under "" (ID 0) for backward compatibility
 
     //@}
 
@@ -121,6 +121,14 @@ namespace YODA {
     /// Fill dimension of this data object
     size_t dim() const { return 1; }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn += _axis.memoryUsage();
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -165,7 +173,7 @@ namespace YODA {
     }
 
     /// check if binning is the same as different Profile1D
-    bool sameBinning(const Profile1D& p1) {
+    bool sameBinning(const Profile1D& p1) const {
       return _axis == p1._axis;
     }
 
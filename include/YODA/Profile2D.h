@@ -125,6 +125,14 @@ namespace YODA {
     /// Fill dimension of this data object
     size_t dim() const { return 2; }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn += _axis.memoryUsage();
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -208,7 +216,7 @@ namespace YODA {
     }
 
     /// check if binning is the same as different Profile2D
-    bool sameBinning(const Profile2D& p2) {
+    bool sameBinning(const Profile2D& p2) const {
       return _axis == p2._axis;
     }
 
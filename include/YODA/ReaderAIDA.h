@@ -16,7 +16,10 @@ namespace YODA {
   class ReaderAIDA : public Reader {
   public:
 
-    /// Singleton creation function
+    /// Constructor of an independent instance
+    ReaderAIDA() { }
+
+    /// Creation function for the calling thread's shared instance
     static Reader& create();
 
     void read(std::istream& stream, std::vector<AnalysisObject*>& aos) {
@@ -27,11 +30,6 @@ namespace YODA {
 
     void _readDoc(std::istream& stream, std::vector<AnalysisObject*>& aos);
 
-  private:
-
-    /// Private constructor, since it's a singleton.
-    ReaderAIDA() { }
-
   };
 
 
@@ -20,16 +20,14 @@ namespace YODA {
   class ReaderFLAT : public Reader {
   public:
 
-    /// Singleton creation function
+    /// Constructor of an independent instance
+    ReaderFLAT() { }
+
+    /// Creation function for the calling thread's shared instance
     static Reader& create();
     
     void read(std::istream& stream, std::vector<AnalysisObject*>& aos);
 
-  private:
-
-    /// Private constructor, since it's a singleton.
-    ReaderFLAT() { }
-
   };
 
 }
@@ -8,6 +8,8 @@
 
 #include "YODA/AnalysisObject.h"
 #include "YODA/Reader.h"
+#include <string>
+#include <vector>
 
 namespace YODA {
 
@@ -16,7 +18,10 @@ namespace YODA {
   class ReaderYODA : public Reader {
   public:
 
-    /// Singleton creation function
+    /// Constructor of an independent instance
+    ReaderYODA() { }
+
+    /// Creation function for the calling thread's shared instance
     static Reader& create();
 
     void read(std::istream& stream, std::vector<AnalysisObject*>& aos);
@@ -24,10 +29,35 @@ namespace YODA {
     // Include definitions of all read methods (all fulfilled by Reader::read(...))
     #include "YODA/ReaderMethods.icc"
 
-  private:
 
-    /// Private constructor, since it's a singleton.
-    ReaderYODA() { }
+    /// @name Metadata scanning
+    //@{
+
+    /// Summary of one object's BEGIN..END block, as found by scan()
+    struct ScanRecord {
+      std::string path; //< object path, from the BEGIN line or a Path annotation
+      std::string type; //< object type name, e.g. "Histo1D", as returned by AnalysisObject::type()
+      size_t begin; //< byte offset of the start of the BEGIN line, in the decompressed data
+      size_t end; //< byte offset just past the END line
+      size_t numLines; //< number of lines from BEGIN to END inclusive
+      size_t numDataLines; //< number of data rows, including total and outflow rows
+      size_t numBins; //< number of bins or points, i.e. data rows excluding total and outflow rows
+      std::string total; //< the "Total" row of a histo or profile, or the data row of a counter, if requested
+    };
+
+    /// @brief Summarise the objects in a YODA-format stream without building them
+    ///
+    /// Only the BEGIN, END and annotation lines are interpreted: data rows are
+    /// counted but their numbers are not parsed, which makes this much cheaper
+    /// than read() for listing a file's contents. If @a withTotals is true, the
+    /// raw (whitespace-trimmed) text of each object's total row is also kept.
+    /// Compressed streams are handled as in read().
+    static std::vector<ScanRecord> scan(std::istream& stream, bool withTotals=false);
+
+    /// Summarise the objects in the YODA-format file @a filename, or stdin if it is "-"
+    static std::vector<ScanRecord> scan(const std::string& filename, bool withTotals=false);
+
+    //@}
 
   };
 
@@ -0,0 +1,142 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_Sampler_h
+#define YODA_Sampler_h
+
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Utils/AliasTable.h"
+#include <random>
+#include <vector>
+#include <utility>
+#include <cstdint>
+
+namespace YODA {
+
+
+  /// @brief Random number source shared by the histogram samplers
+  ///
+  /// A 64-bit Mersenne twister, turned into doubles in [0,1) with 53 random bits.
+  class SamplerRNG {
+  public:
+
+    explicit SamplerRNG(uint64_t seed) : _engine(seed) {  }
+
+    /// Restart the sequence from @a seed
+    void seed(uint64_t seed) { _engine.seed(seed); }
+
+    /// Uniform random number in [0,1)
+    double uniform() { return (_engine() >> 11) * (1.0/9007199254740992.0); }
+
+  private:
+
+    std::mt19937_64 _engine;
+
+  };
+
+
+  /// @brief Draws random x values distributed as a Histo1D
+  ///
+  /// A bin is chosen with probability proportional to its sum of weights
+  /// by an alias table, in constant time whatever the number of bins, and
+  /// the value is placed uniformly within it. Under- and overflows are not
+  /// sampled. The sampler copies what it needs from the histogram, so later
+  /// changes to the histogram don't affect it.
+  ///
+  /// Use one sampler per thread: drawing advances its random number sequence.
+  class Histo1DSampler {
+  public:
+
+    /// @brief Make a sampler of @a h, starting the random sequence from @a seed
+    ///
+    /// Throws a WeightError if any bin has a negative sum of weights, or the histogram is empty.
+    Histo1DSampler(const Histo1D& h, uint64_t seed=std::mt19937_64::default_seed);
+
+    /// Restart the random sequence from @a seed
+    void seed(uint64_t seed) { _rng.seed(seed); }
+
+    /// Number of bins that can be drawn from
+    size_t numBins() const { return _table.size(); }
+
+    /// Draw one value
+    double sample() {
+      const Edges& b = _edges[_table.index(_rng.uniform())];
+      return b.low + _rng.uniform() * b.width;
+    }
+
+    /// Draw @a n values into @a xs
+    void sample(double* xs, size_t n) {
+      for (size_t i = 0; i < n; ++i) xs[i] = sample();
+    }
+
+    /// Draw xs.size() values into @a xs
+    void sample(std::vector<double>& xs) {
+      sample(xs.data(), xs.size());
+    }
+
+  private:
+
+    struct Edges {
+      double low, width;
+    };
+
+    Utils::AliasTable _table;
+    std::vector<Edges> _edges;
+    SamplerRNG _rng;
+
+  };
+
+
+  /// @brief Draws random (x,y) points distributed as a Histo2D
+  ///
+  /// As for Histo1DSampler, with the points placed uniformly in the chosen
+  /// bin's rectangle.
+  class Histo2DSampler {
+  public:
+
+    /// @brief Make a sampler of @a h, starting the random sequence from @a seed
+    ///
+    /// Throws a WeightError if any bin has a negative sum of weights, or the histogram is empty.
+    Histo2DSampler(const Histo2D& h, uint64_t seed=std::mt19937_64::default_seed);
+
+    /// Restart the random sequence from @a seed
+    void seed(uint64_t seed) { _rng.seed(seed); }
+
+    /// Number of bins that can be drawn from
+    size_t numBins() const { return _table.size(); }
+
+    /// Draw one point
+    std::pair<double,double> sample() {
+      const Edges& b = _edges[_table.index(_rng.uniform())];
+      const double x = b.xlow + _rng.uniform() * b.xwidth;
+      return std::make_pair(x, b.ylow + _rng.uniform() * b.ywidth);
+    }
+
+    /// Draw @a n points into @a xs and @a ys
+    void sample(double* xs, double* ys, size_t n) {
+      for (size_t i = 0; i < n; ++i) {
+        const Edges& b = _edges[_table.index(_rng.uniform())];
+        xs[i] = b.xlow + _rng.uniform() * b.xwidth;
+        ys[i] = b.ylow + _rng.uniform() * b.ywidth;
+      }
+    }
+
+  private:
+
+    struct Edges {
+      double xlow, xwidth, ylow, ywidth;
+    };
+
+    Utils::AliasTable _table;
+    std::vector<Edges> _edges;
+    SamplerRNG _rng;
+
+  };
+
+
+}
+
+#endif
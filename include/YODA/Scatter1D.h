@@ -43,7 +43,9 @@ namespace YODA {
               const std::string& path="", const std::string& title="")
       : AnalysisObject("Scatter1D", path, title),
         _points(points)
-    {  }
+    {
+      for (Point1D& pt : _points) _adopt(pt);
+    }
 
 
     /// Constructor from a vector of x values with no errors
@@ -51,7 +53,9 @@ namespace YODA {
               const std::string& path="", const std::string& title="")
       : AnalysisObject("Scatter1D", path, title)
     {
-      for (size_t i = 0; i < x.size(); ++i) addPoint(x[i]);
+      std::vector<Point1D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point1D(x[i]));
+      addPoints(pts);
     }
 
 
@@ -61,7 +65,9 @@ namespace YODA {
       : AnalysisObject("Scatter1D", path, title)
     {
       if (x.size() != ex.size()) throw UserError("x and ex vectors must have same length");
-      for (size_t i = 0; i < x.size(); ++i) addPoint(x[i], ex[i]);
+      std::vector<Point1D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point1D(x[i], ex[i]));
+      addPoints(pts);
     }
 
     /// Constructor from x values with asymmetric errors
@@ -70,7 +76,9 @@ namespace YODA {
       : AnalysisObject("Scatter1D", path, title)
     {
       if (x.size() != ex.size()) throw UserError("x and ex vectors must have same length");
-      for (size_t i = 0; i < x.size(); ++i) addPoint(Point1D(x[i], ex[i]));
+      std::vector<Point1D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point1D(x[i], ex[i]));
+      addPoints(pts);
     }
 
 
@@ -83,7 +91,9 @@ namespace YODA {
     {
       if (x.size() != exminus.size()) throw UserError("x and ex vectors must have same length");
       if (exminus.size() != explus.size()) throw UserError("ex plus and minus vectors must have same length");
-      for (size_t i = 0; i < x.size(); ++i) addPoint(Point1D(x[i], exminus[i], explus[i]));
+      std::vector<Point1D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point1D(x[i], exminus[i], explus[i]));
+      addPoints(pts);
     }
 
 
@@ -91,8 +101,11 @@ namespace YODA {
     /// @todo Also allow title setting from the constructor?
     Scatter1D(const Scatter1D& s1, const std::string& path="")
       : AnalysisObject("Scatter1D", (path.size() == 0) ? s1.path() : path, s1, s1.title()),
-        _points(s1._points)
+        _points(s1._points),
+        _vartable(std::make_shared<Utils::VariationTable>(*s1._vartable)),
+        _variationsParsed(s1._variationsParsed)
     {
+      for (Point1D& pt : _points) _adopt(pt);
       for ( auto &ann : annotations()){
         setAnnotation(ann, annotation(ann));
       }
@@ -103,6 +116,9 @@ namespace YODA {
     Scatter1D& operator = (const Scatter1D& s1) {
       AnalysisObject::operator = (s1); //< AO treatment of paths etc.
       _points = s1._points;
+      _vartable = std::make_shared<Utils::VariationTable>(*s1._vartable);
+      _variationsParsed = s1._variationsParsed;
+      for (Point1D& pt : _points) _adopt(pt);
       return *this;
     }
 
@@ -122,6 +138,16 @@ namespace YODA {
     /// Dimension of this data object
     size_t dim() const { return 1; }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn.bins = Utils::heapSize(_points);
+      for (const Point1D& p : _points) rtn.errors += p.heapSize();
+      if (_vartable) rtn.errors += Utils::SHARED_PTR_OVERHEAD + sizeof(Utils::VariationTable) + _vartable->heapSize();
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -143,6 +169,11 @@ namespace YODA {
     
     void parseVariations() ;
 
+    /// Get the table of variation names and IDs shared by the points
+    const Utils::VariationTable& variationTable() const {
+      return *_vartable;
+    }
+
     /// Get the list of variations stored in the points
     const std::vector<std::string> variations() const ;
 
@@ -188,40 +219,65 @@ namespace YODA {
 
     /// Insert a new point
     void addPoint(const Point1D& pt) {
-      _points.insert(pt);
+      Point1D thisPoint = pt;
+      _adopt(thisPoint);
+      _points.insert(thisPoint);
     }
 
     /// Insert a new point, defined as the x value and no errors
     void addPoint(double x) {
       Point1D thisPoint=Point1D(x);
-      thisPoint.setParentAO(this); 
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
     /// Insert a new point, defined as the x value and symmetric errors
     void addPoint(double x, double ex) {
       Point1D thisPoint=Point1D(x, ex);
-      thisPoint.setParentAO(this); 
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
     /// Insert a new point, defined as the x value and an asymmetric error pair
     void addPoint(double x, const std::pair<double,double>& ex) {
       Point1D thisPoint=Point1D(x, ex);
-      thisPoint.setParentAO(this); 
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
     /// Insert a new point, defined as the x value and explicit asymmetric errors
     void addPoint(double x, double exminus, double explus) {
       Point1D thisPoint=Point1D(x, exminus, explus);
-      thisPoint.setParentAO(this); 
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
-    /// Insert a collection of new points
-    void addPoints(const Points& pts) {
-      for (const Point1D& pt : pts) addPoint(pt);
+    /// @brief Insert a collection of new points
+    ///
+    /// The points are appended and sorted in a single pass, which is linear
+    /// if they are already in order, rather than being inserted one by one.
+    void addPoints(const std::vector<Point1D>& pts) {
+      // Work out the variation-ID mapping once per foreign table, not once per point
+      Point::VariationTablePtr lasttable;
+      std::vector<size_t> idmap;
+      std::vector<Point1D> newpts;
+      newpts.reserve(pts.size());
+      for (const Point1D& pt : pts) {
+        Point1D thisPoint = pt;
+        thisPoint.setParentAO(this);
+        const Point::VariationTablePtr& table = pt.variationTable();
+        if (table && table != _vartable) {
+          if (table != lasttable) {
+            lasttable = table;
+            idmap = _vartable->intern(*table);
+          }
+          thisPoint.setVariationTable(_vartable, idmap);
+        } else {
+          thisPoint.setVariationTable(_vartable);
+        }
+        newpts.push_back(thisPoint);
+      }
+      _points.insert(newpts.begin(), newpts.end());
     }
 
     //@}
@@ -261,7 +317,16 @@ namespace YODA {
 
   private:
 
+    /// Attach a point to this scatter, re-indexing its errors against our variation table
+    void _adopt(Point1D& pt) {
+      pt.setParentAO(this);
+      pt.setVariationTable(_vartable);
+    }
+
     Points _points;
+
+    /// Variation names and IDs, shared with all the points
+    std::shared_ptr<Utils::VariationTable> _vartable = std::make_shared<Utils::VariationTable>();
     
     bool _variationsParsed =false ;
 
@@ -8,6 +8,7 @@
 
 #include "YODA/AnalysisObject.h"
 #include "YODA/Point2D.h"
+#include "YODA/CovarianceMatrix.h"
 #include "YODA/Utils/sortedvector.h"
 #include <utility>
 #include <memory>
@@ -44,7 +45,9 @@ namespace YODA {
               const std::string& path="", const std::string& title="")
       : AnalysisObject("Scatter2D", path, title),
         _points(points)
-    {  }
+    {
+      for (Point2D& pt : _points) _adopt(pt);
+    }
 
 
     /// Constructor from a vector of values with no errors
@@ -53,7 +56,9 @@ namespace YODA {
       : AnalysisObject("Scatter2D", path, title)
     {
       if (x.size() != y.size()) throw UserError("x and y vectors must have same length");
-      for (size_t i = 0; i < x.size(); ++i) addPoint(x[i], y[i]);
+      std::vector<Point2D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point2D(x[i], y[i]));
+      addPoints(pts);
     }
 
 
@@ -66,7 +71,9 @@ namespace YODA {
       if (x.size() != y.size()) throw UserError("x and y vectors must have same length");
       if (x.size() != ex.size()) throw UserError("x and ex vectors must have same length");
       if (y.size() != ey.size()) throw UserError("y and ey vectors must have same length");
-      for (size_t i = 0; i < x.size(); ++i) addPoint(x[i], y[i], ex[i], ey[i]);
+      std::vector<Point2D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point2D(x[i], y[i], ex[i], ey[i]));
+      addPoints(pts);
     }
 
 
@@ -79,7 +86,9 @@ namespace YODA {
       if (x.size() != y.size()) throw UserError("x and y vectors must have same length");
       if (x.size() != ex.size()) throw UserError("x and ex vectors must have same length");
       if (y.size() != ey.size()) throw UserError("y and ey vectors must have same length");
-      for (size_t i = 0; i < x.size(); ++i) addPoint(Point2D(x[i], y[i], ex[i], ey[i]));
+      std::vector<Point2D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point2D(x[i], y[i], ex[i], ey[i]));
+      addPoints(pts);
     }
 
 
@@ -95,7 +104,9 @@ namespace YODA {
       if (y.size() != eyminus.size()) throw UserError("y and ey vectors must have same length");
       if (exminus.size() != explus.size()) throw UserError("ex plus and minus vectors must have same length");
       if (eyminus.size() != eyplus.size()) throw UserError("ey plus and minus vectors must have same length");
-      for (size_t i = 0; i < x.size(); ++i) addPoint(Point2D(x[i], y[i], exminus[i], explus[i], eyminus[i], eyplus[i]));
+      std::vector<Point2D> pts; pts.reserve(x.size());
+      for (size_t i = 0; i < x.size(); ++i) pts.push_back(Point2D(x[i], y[i], exminus[i], explus[i], eyminus[i], eyplus[i]));
+      addPoints(pts);
     }
 
 
@@ -103,8 +114,11 @@ namespace YODA {
     /// @todo Also allow title setting from the constructor?
     Scatter2D(const Scatter2D& s2, const std::string& path="")
       : AnalysisObject("Scatter2D", (path.size() == 0) ? s2.path() : path, s2, s2.title()),
-        _points(s2._points)
+        _points(s2._points),
+        _vartable(std::make_shared<Utils::VariationTable>(*s2._vartable)),
+        _variationsParsed(s2._variationsParsed)
     {
+      for (Point2D& pt : _points) _adopt(pt);
       for ( auto &ann : annotations()){
         setAnnotation(ann, annotation(ann));
       }
@@ -115,6 +129,9 @@ namespace YODA {
     Scatter2D& operator = (const Scatter2D& s2) {
       AnalysisObject::operator = (s2); //< AO treatment of paths etc.
       _points = s2._points;
+      _vartable = std::make_shared<Utils::VariationTable>(*s2._vartable);
+      _variationsParsed = s2._variationsParsed;
+      for (Point2D& pt : _points) _adopt(pt);
       return *this;
     }
 
@@ -134,6 +151,16 @@ namespace YODA {
     /// Dimension of this data object
     size_t dim() const { return 2; }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn.bins = Utils::heapSize(_points);
+      for (const Point2D& p : _points) rtn.errors += p.heapSize();
+      if (_vartable) rtn.errors += Utils::SHARED_PTR_OVERHEAD + sizeof(Utils::VariationTable) + _vartable->heapSize();
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -171,11 +198,25 @@ namespace YODA {
 
     void parseVariations() ;
 
+    /// Get the table of variation names and IDs shared by the points
+    const Utils::VariationTable& variationTable() const {
+      return *_vartable;
+    }
+
     /// Get the list of variations stored in the points
     const std::vector<std::string> variations() const;
 
-    // Construct a covariance matrix from the error breakdown
-    std::vector<std::vector<double> > covarianceMatrix(bool ignoreOffDiagonalTerms=false) ;
+    /// @brief Construct the covariance matrix from the error breakdown, split by correlation
+    ///
+    /// Variations whose names contain "stat" or "uncor" (or all of them, if
+    /// @a ignoreOffDiagonalTerms is set) only contribute to the diagonal; the
+    /// rest are treated as fully correlated between points. Up/down errors are
+    /// symmetrised. The correlated part is built as a single multithreaded
+    /// rank-k update over all variations, using @a nthreads threads (0 = auto).
+    CovarianceSplit covariance(bool ignoreOffDiagonalTerms=false, size_t nthreads=0) const;
+
+    /// Construct a covariance matrix from the error breakdown
+    std::vector<std::vector<double> > covarianceMatrix(bool ignoreOffDiagonalTerms=false) const;
 
     /// @name Point accessors
     //@{
@@ -219,13 +260,15 @@ namespace YODA {
 
     /// Insert a new point
     void addPoint(const Point2D& pt) {
-      _points.insert(pt);
+      Point2D thisPoint = pt;
+      _adopt(thisPoint);
+      _points.insert(thisPoint);
     }
 
     /// Insert a new point, defined as the x/y value pair and no errors
     void addPoint(double x, double y) {
       Point2D thisPoint= Point2D(x, y);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
@@ -233,7 +276,7 @@ namespace YODA {
     void addPoint(double x, double y,
                   double ex, double ey) {
       Point2D thisPoint= Point2D(x, y, ex, ey);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
@@ -241,7 +284,7 @@ namespace YODA {
     void addPoint(double x, double y,
                   const std::pair<double,double>& ex, const std::pair<double,double>& ey) {
       Point2D thisPoint= Point2D(x, y, ex, ey);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
@@ -250,15 +293,36 @@ namespace YODA {
                   double exminus, double explus,
                   double eyminus, double eyplus) {
       Point2D thisPoint=Point2D(x, y, exminus, explus, eyminus, eyplus);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
-    /// Insert a collection of new points
-    void addPoints(const Points& pts) {
+    /// @brief Insert a collection of new points
+    ///
+    /// The points are appended and sorted in a single pass, which is linear
+    /// if they are already in order, rather than being inserted one by one.
+    void addPoints(const std::vector<Point2D>& pts) {
+      // Work out the variation-ID mapping once per foreign table, not once per point
+      Point::VariationTablePtr lasttable;
+      std::vector<size_t> idmap;
+      std::vector<Point2D> newpts;
+      newpts.reserve(pts.size());
       for (const Point2D& pt : pts) {
-        addPoint(pt);
+        Point2D thisPoint = pt;
+        thisPoint.setParentAO(this);
+        const Point::VariationTablePtr& table = pt.variationTable();
+        if (table && table != _vartable) {
+          if (table != lasttable) {
+            lasttable = table;
+            idmap = _vartable->intern(*table);
+          }
+          thisPoint.setVariationTable(_vartable, idmap);
+        } else {
+          thisPoint.setVariationTable(_vartable);
         }
+        newpts.push_back(thisPoint);
+      }
+      _points.insert(newpts.begin(), newpts.end());
     }
 
     //@}
@@ -300,8 +364,17 @@ namespace YODA {
 
   private:
 
+    /// Attach a point to this scatter, re-indexing its errors against our variation table
+    void _adopt(Point2D& pt) {
+      pt.setParentAO(this);
+      pt.setVariationTable(_vartable);
+    }
+
     Points _points;
 
+    /// Variation names and IDs, shared with all the points
+    std::shared_ptr<Utils::VariationTable> _vartable = std::make_shared<Utils::VariationTable>();
+
     bool _variationsParsed =false ;
 
   };
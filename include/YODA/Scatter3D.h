@@ -45,7 +45,7 @@ namespace YODA {
       : AnalysisObject("Scatter3D", path, title),
         _points(points)
     {
-      std::sort(_points.begin(), _points.end());
+      for (Point3D& pt : _points) _adopt(pt);
     }
 
 
@@ -61,10 +61,11 @@ namespace YODA {
         throw RangeError("There are different numbers of x, y, and z values in the provided vectors.");
       }
       const std::pair<double,double> nullerr = std::make_pair(0.0, 0.0);
+      std::vector<Point3D> pts; pts.reserve(x.size());
       for (size_t i = 0; i < x.size(); ++i) {
-        addPoint(Point3D(x[i], y[i], z[i], nullerr, nullerr, nullerr));
+        pts.push_back(Point3D(x[i], y[i], z[i], nullerr, nullerr, nullerr));
       }
-      std::sort(_points.begin(), _points.end());
+      addPoints(pts);
     }
 
 
@@ -80,10 +81,11 @@ namespace YODA {
       if (x.size() != ex.size() || y.size() != ey.size() || z.size() != ez.size()) {
         throw RangeError("The sizes of the provided error vectors don't match the corresponding x, y, or z value vectors.");
       }
+      std::vector<Point3D> pts; pts.reserve(x.size());
       for (size_t i = 0; i < x.size(); ++i) {
-        addPoint(Point3D(x[i], y[i], z[i], ex[i], ey[i], ez[i]));
+        pts.push_back(Point3D(x[i], y[i], z[i], ex[i], ey[i], ez[i]));
       }
-      std::sort(_points.begin(), _points.end());
+      addPoints(pts);
     }
 
 
@@ -104,11 +106,11 @@ namespace YODA {
          z.size() != ezminus.size() || z.size() != ezplus.size())
         throw RangeError("There are either different amounts of points on x/y/z vectors or not every of these vectors has properly defined error vectors!");
 
+      std::vector<Point3D> pts; pts.reserve(x.size());
       for (size_t i = 0; i < x.size(); ++i) {
-        addPoint(Point3D(x[i], y[i], z[i], exminus[i], explus[i], eyminus[i], eyplus[i], ezminus[i], ezplus[i]));
+        pts.push_back(Point3D(x[i], y[i], z[i], exminus[i], explus[i], eyminus[i], eyplus[i], ezminus[i], ezplus[i]));
       }
-
-      std::sort(_points.begin(), _points.end());
+      addPoints(pts);
     }
 
 
@@ -116,8 +118,11 @@ namespace YODA {
     /// @todo Also allow title setting from the constructor?
     Scatter3D(const Scatter3D& s3, const std::string& path="")
       : AnalysisObject("Scatter3D", (path.size() == 0) ? s3.path() : path, s3, s3.title()),
-        _points(s3._points)
+        _points(s3._points),
+        _vartable(std::make_shared<Utils::VariationTable>(*s3._vartable)),
+        _variationsParsed(s3._variationsParsed)
     {
+      for (Point3D& pt : _points) _adopt(pt);
       for ( auto &ann : annotations()){
         setAnnotation(ann, annotation(ann));
       }
@@ -127,6 +132,9 @@ namespace YODA {
     Scatter3D& operator = (const Scatter3D& s3) {
       AnalysisObject::operator = (s3); //< AO treatment of paths etc.
       _points = s3._points;
+      _vartable = std::make_shared<Utils::VariationTable>(*s3._vartable);
+      _variationsParsed = s3._variationsParsed;
+      for (Point3D& pt : _points) _adopt(pt);
       return *this;
     }
 
@@ -146,6 +154,16 @@ namespace YODA {
     /// Dimension of this data object
     size_t dim() const { return 3; }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn.bins = Utils::heapSize(_points);
+      for (const Point3D& p : _points) rtn.errors += p.heapSize();
+      if (_vartable) rtn.errors += Utils::SHARED_PTR_OVERHEAD + sizeof(Utils::VariationTable) + _vartable->heapSize();
+      return rtn;
+    }
+
 
     /// @name Modifiers
     //@{
@@ -187,6 +205,11 @@ namespace YODA {
 
     void parseVariations() ;
 
+    /// Get the table of variation names and IDs shared by the points
+    const Utils::VariationTable& variationTable() const {
+      return *_vartable;
+    }
+
     /// Get the list of variations stored in the points
     const std::vector<std::string> variations() const;
 
@@ -233,13 +256,15 @@ namespace YODA {
 
     /// Insert a new point
     void addPoint(const Point3D& pt) {
-      _points.insert(pt);
+      Point3D thisPoint = pt;
+      _adopt(thisPoint);
+      _points.insert(thisPoint);
     }
 
     /// Insert a new point, defined as the x/y/z value triplet and no errors
     void addPoint(double x, double y, double z) {
       Point3D thisPoint=Point3D(x, y, z);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
@@ -247,7 +272,7 @@ namespace YODA {
     void addPoint(double x, double y, double z,
                   double ex, double ey, double ez) {
       Point3D thisPoint=Point3D(x, y, z, ex, ey, ez);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
@@ -255,7 +280,7 @@ namespace YODA {
     void addPoint(double x, double y, double z,
                   const std::pair<double,double>& ex, const std::pair<double,double>& ey, const std::pair<double,double>& ez) {
       Point3D thisPoint= Point3D(x, y, z, ex, ey, ez);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
@@ -265,13 +290,36 @@ namespace YODA {
                   double eyminus, double eyplus,
                   double ezminus, double ezplus) {
       Point3D thisPoint = Point3D(x, y, z, exminus, explus, eyminus, eyplus, ezminus, ezplus);
-      thisPoint.setParentAO(this);
+      _adopt(thisPoint);
       _points.insert(thisPoint);
     }
 
-    /// Insert a collection of new points
-    void addPoints(const Points& pts) {
-      for (const Point3D& pt : pts) addPoint(pt);
+    /// @brief Insert a collection of new points
+    ///
+    /// The points are appended and sorted in a single pass, which is linear
+    /// if they are already in order, rather than being inserted one by one.
+    void addPoints(const std::vector<Point3D>& pts) {
+      // Work out the variation-ID mapping once per foreign table, not once per point
+      Point::VariationTablePtr lasttable;
+      std::vector<size_t> idmap;
+      std::vector<Point3D> newpts;
+      newpts.reserve(pts.size());
+      for (const Point3D& pt : pts) {
+        Point3D thisPoint = pt;
+        thisPoint.setParentAO(this);
+        const Point::VariationTablePtr& table = pt.variationTable();
+        if (table && table != _vartable) {
+          if (table != lasttable) {
+            lasttable = table;
+            idmap = _vartable->intern(*table);
+          }
+          thisPoint.setVariationTable(_vartable, idmap);
+        } else {
+          thisPoint.setVariationTable(_vartable);
+        }
+        newpts.push_back(thisPoint);
+      }
+      _points.insert(newpts.begin(), newpts.end());
     }
 
     //@}
@@ -308,8 +356,17 @@ namespace YODA {
 
   private:
 
+    /// Attach a point to this scatter, re-indexing its errors against our variation table
+    void _adopt(Point3D& pt) {
+      pt.setParentAO(this);
+      pt.setVariationTable(_vartable);
+    }
+
     Points _points;
 
+    /// Variation names and IDs, shared with all the points
+    std::shared_ptr<Utils::VariationTable> _vartable = std::make_shared<Utils::VariationTable>();
+
     bool _variationsParsed =false ;
 
   };
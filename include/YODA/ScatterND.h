@@ -126,6 +126,18 @@ namespace YODA {
       _points.clear();
     }
 
+    /// Memory used by this object, by component
+    MemoryUsage memoryUsage() const {
+      MemoryUsage rtn = AnalysisObject::memoryUsage();
+      rtn.object = sizeof(*this);
+      rtn.bins = Utils::heapSize(_points);
+      for (const Point<N>& p : _points) {
+        rtn.errors += Utils::heapSize(p.errs());
+        for (const Error<N>& e : p.errs()) rtn.errors += Utils::heapSize(e.name());
+      }
+      return rtn;
+    }
+
     /// Scaling
     void scale(const NdVal& scales) {
       for (Point<N>& p : _points) p.scale(scales);
@@ -190,8 +202,8 @@ namespace YODA {
     /// @todo More addPoint combinations with arrays for errors
 
     /// Insert a collection of new points
-    Scatter<N>& addPoints(Points pts) {
-      for (const Point<N>& pt : pts) addPoint(pt);
+    Scatter<N>& addPoints(const Points& pts) {
+      _points.insert(pts.begin(), pts.end());
       return *this;
     }
 
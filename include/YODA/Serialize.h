@@ -0,0 +1,42 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_Serialize_h
+#define YODA_Serialize_h
+
+#include "YODA/AnalysisObject.h"
+#include <string>
+
+namespace YODA {
+
+
+  /// @brief Encode an analysis object in a compact binary form
+  ///
+  /// The encoding holds the annotations, bin edges, the raw Dbn sums of the
+  /// bins and the total and outflow distributions, or the point values and
+  /// full error breakdown of a scatter, as native-endian doubles, so that
+  /// objects can be passed between processes without the cost of formatting
+  /// and parsing YODA text. As with the YODA text format, 2D outflows are not
+  /// included. It is not intended as a persistent file format: the byte order
+  /// and layout are only guaranteed to be understood by the same YODA version
+  /// on the same architecture.
+  std::string serialize(const AnalysisObject& ao);
+
+
+  /// @brief Decode an analysis object from the output of serialize()
+  ///
+  /// The returned object is newly allocated and owned by the caller.
+  /// A ReadError is thrown if the data is truncated or not in this format.
+  AnalysisObject* deserialize(const char* data, size_t size);
+
+  /// Decode an analysis object from the output of serialize(), held in a string
+  inline AnalysisObject* deserialize(const std::string& data) {
+    return deserialize(data.data(), data.size());
+  }
+
+
+}
+
+#endif
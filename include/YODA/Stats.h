@@ -0,0 +1,121 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_Stats_h
+#define YODA_Stats_h
+
+#include "YODA/Config/BuildConfig.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace YODA {
+
+
+  /// @brief Instrumentation counters and timers for performance tuning
+  ///
+  /// Bin lookups, Histo1D fills and YODA-format reading and writing are
+  /// counted and timed when YODA is configured with --enable-stats, which
+  /// defines YODA_STATS in YODA/Config/BuildConfig.h. Otherwise the
+  /// YODA_STATS_* macros expand to nothing, so the instrumented code is
+  /// exactly as it would be without them, and all the values stay zero.
+  ///
+  /// The counters are relaxed atomics shared by all threads: cheap, but not
+  /// free, and a point of contention for heavily threaded filling.
+  namespace Stats {
+
+    /// Names of the counters and timers
+    enum Key {
+      BINSEARCH_DIRECT, //< lookups answered by the estimator's guess
+      BINSEARCH_LINEAR, //< lookups which needed a short linear search from the guess
+      BINSEARCH_BISECT, //< lookups which fell back to bisection
+      HISTO1D_FILL_INRANGE, //< Histo1D fills within the axis range
+      HISTO1D_FILL_GAP, //< Histo1D fills which hit a gap in the binning
+      HISTO1D_FILL_UNDERFLOW, //< Histo1D fills below the axis range
+      HISTO1D_FILL_OVERFLOW, //< Histo1D fills above the axis range
+      HISTO1D_FILL_NAN, //< Histo1D fills rejected with a RangeError for a NaN x
+      READER_OBJECTS, //< objects read by ReaderYODA
+      READER_LINES, //< lines read by ReaderYODA
+      READER_NS, //< total time in ReaderYODA::read
+      READER_YAML_NS, //< time parsing annotations with yaml-cpp
+      READER_BUILD_NS, //< time adding the parsed bins and points to the objects
+      WRITER_OBJECTS, //< objects written by Writer::write
+      WRITER_NS, //< total time in Writer::write
+      NUM_KEYS
+    };
+
+    /// Whether this build of YODA was configured with --enable-stats
+    bool enabled();
+
+    /// @brief Current values, keyed by name, e.g. "binsearch_direct"
+    ///
+    /// Timers are given in seconds, with a "_seconds" suffix. The reader's
+    /// tokenizing time is derived as its total less its YAML and build time.
+    std::map<std::string, double> values();
+
+    /// Zero all the counters and timers
+    void reset();
+
+    /// @brief Human-readable summary of the values
+    ///
+    /// Lookup and fill counts are also shown as fractions of their totals.
+    std::string summary();
+
+
+    /// @name Recording, for use through the YODA_STATS_* macros
+    //@{
+
+    /// Storage of the counters and timers, the latter in nanoseconds
+    extern std::atomic<uint64_t> _values[NUM_KEYS];
+
+    /// Add @a n to counter @a key
+    inline void add(Key key, uint64_t n=1) {
+      _values[key].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    /// Adds the time between its construction and destruction to timer @a key
+    class ScopedTimer {
+    public:
+      explicit ScopedTimer(Key key)
+        : _key(key), _start(std::chrono::steady_clock::now())
+      {  }
+      ~ScopedTimer() {
+        const auto dt = std::chrono::steady_clock::now() - _start;
+        add(_key, std::chrono::duration_cast<std::chrono::nanoseconds>(dt).count());
+      }
+      ScopedTimer(const ScopedTimer&) = delete;
+      ScopedTimer& operator = (const ScopedTimer&) = delete;
+    private:
+      Key _key;
+      std::chrono::steady_clock::time_point _start;
+    };
+
+    //@}
+
+  }
+
+
+}
+
+
+/// @def YODA_STATS_COUNT(key)
+/// Increment instrumentation counter YODA::Stats::key, if enabled
+/// @def YODA_STATS_ADD(key, n)
+/// Add @a n to instrumentation counter YODA::Stats::key, if enabled
+/// @def YODA_STATS_TIME(key)
+/// Time the rest of the enclosing scope into YODA::Stats::key, if enabled
+#ifdef YODA_STATS
+#define YODA_STATS_COUNT(key) ::YODA::Stats::add(::YODA::Stats::key)
+#define YODA_STATS_ADD(key, n) ::YODA::Stats::add(::YODA::Stats::key, (n))
+#define YODA_STATS_TIME(key) ::YODA::Stats::ScopedTimer _yoda_stats_timer_##key(::YODA::Stats::key)
+#else
+#define YODA_STATS_COUNT(key) do { } while (false)
+#define YODA_STATS_ADD(key, n) do { } while (false)
+#define YODA_STATS_TIME(key) do { } while (false)
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_ALIASTABLE_H
+#define YODA_ALIASTABLE_H
+
+#include "YODA/Exceptions.h"
+#include "YODA/Utils/MemoryUsage.h"
+#include <vector>
+#include <cmath>
+
+namespace YODA {
+  namespace Utils {
+
+
+    /// @brief Walker's alias table, for drawing indices with given weights in constant time
+    ///
+    /// Each of the n cells holds a threshold and an alias: a uniform number
+    /// picks a cell and a position within it, giving the cell's own index
+    /// below the threshold and the alias above. Built with Vose's method in
+    /// O(n) time.
+    class AliasTable {
+    public:
+
+      AliasTable() {  }
+
+      /// @brief Build from non-negative weights, which need not be normalised
+      ///
+      /// Throws a WeightError if any weight is negative or not finite, or if all are zero.
+      explicit AliasTable(const std::vector<double>& weights) {
+        const size_t n = weights.size();
+        double total = 0;
+        for (double w : weights) {
+          if (!(w >= 0) || !std::isfinite(w)) throw WeightError("Alias table weights must be non-negative and finite");
+          total += w;
+        }
+        if (total == 0) throw WeightError("Alias table weights sum to zero");
+
+        // Scale so that the mean is 1, then pair off cells below 1 with cells above
+        _cells.resize(n);
+        std::vector<size_t> small, large;
+        for (size_t i = 0; i < n; ++i) {
+          _cells[i].prob = weights[i] * n / total;
+          _cells[i].alias = i;
+          (_cells[i].prob < 1 ? small : large).push_back(i);
+        }
+        while (!small.empty() && !large.empty()) {
+          const size_t s = small.back(), l = large.back();
+          small.pop_back();
+          _cells[s].alias = l;
+          _cells[l].prob -= 1 - _cells[s].prob;
+          if (_cells[l].prob < 1) {
+            large.pop_back();
+            small.push_back(l);
+          }
+        }
+        // What is left is 1 up to rounding
+        for (size_t i : small) _cells[i].prob = 1;
+        for (size_t i : large) _cells[i].prob = 1;
+      }
+
+      /// Number of indices
+      size_t size() const { return _cells.size(); }
+
+      /// Index for a uniform random number @a u in [0,1)
+      size_t index(double u) const {
+        const double un = u * _cells.size();
+        size_t i = static_cast<size_t>(un);
+        if (i >= _cells.size()) i = _cells.size() - 1;
+        const Cell& c = _cells[i];
+        return (un - i) < c.prob ? i : c.alias;
+      }
+
+      /// Heap bytes used by the table
+      size_t heapSize() const { return Utils::heapSize(_cells); }
+
+    private:
+
+      /// Threshold and alias together, so that a draw reads one cache line
+      struct Cell {
+        double prob;
+        size_t alias;
+      };
+
+      std::vector<Cell> _cells;
+
+    };
+
+
+  }
+}
+
+#endif
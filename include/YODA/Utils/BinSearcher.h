@@ -8,6 +8,8 @@
 
 #include "YODA/Utils/fastlog.h"
 #include "YODA/Utils/MathUtils.h"
+#include "YODA/Stats.h"
+#include "YODA/Utils/MemoryUsage.h"
 #include <cstdlib>
 #include <cmath>
 #include <vector>
@@ -201,16 +203,22 @@ namespace YODA {
         // Get initial estimate
         size_t index = std::min(_est->estindex(x),_edges.size()-1);
         // Return now if this is the correct bin
-        if (x >= _edges[index] && x < _edges[index+1]) return index;
+        if (x >= _edges[index] && x < _edges[index+1]) {
+          YODA_STATS_COUNT(BINSEARCH_DIRECT);
+          return index;
+        }
 
         // Otherwise refine the estimate, if x is not exactly on a bin edge
+        ssize_t newindex = -1;
         if (x > _edges[index]) {
-          const ssize_t newindex = _linsearch_forward(index, x, SEARCH_SIZE);
+          newindex = _linsearch_forward(index, x, SEARCH_SIZE);
           index = (newindex > 0) ? newindex : _bisect(x, index, _edges.size()-1);
         } else if (x < _edges[index]) {
-          const ssize_t newindex = _linsearch_backward(index, x, SEARCH_SIZE);
+          newindex = _linsearch_backward(index, x, SEARCH_SIZE);
           index = (newindex > 0) ? newindex : _bisect(x, 0, index+1);
         }
+        if (newindex > 0) YODA_STATS_COUNT(BINSEARCH_LINEAR);
+        else YODA_STATS_COUNT(BINSEARCH_BISECT);
 
         assert(x >= _edges[index] && (x < _edges[index+1] || std::isinf(x)));
         return index;
@@ -234,6 +242,12 @@ namespace YODA {
       /// How many bin edges in this searcher?
       size_t size() const { return _edges.size(); }
 
+      /// Heap bytes used by the edges and the (possibly shared) estimator
+      size_t heapSize() const {
+        // Both estimator types have the same members
+        return Utils::heapSize(_edges) + (_est ? SHARED_PTR_OVERHEAD + sizeof(LinEstimator) : 0);
+      }
+
 
       /// Check if two BinSearcher objects have the same edges
       bool same_edges(const BinSearcher& other) const {
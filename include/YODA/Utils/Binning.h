@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_BINNING_H
+#define YODA_BINNING_H
+
+#include "YODA/Utils/BinSearcher.h"
+#include "YODA/Utils/MemoryUsage.h"
+#include <vector>
+#include <memory>
+
+namespace YODA {
+  namespace Utils {
+
+
+    /// @brief Immutable bin lookup structure, shared by all axes with identical binnings
+    ///
+    /// Holds the bin searcher(s) and the map from searcher cells to bin
+    /// indices, with -1 for gaps, which an Axis1D or Axis2D derives from its
+    /// bins. Instances are hash-consed by get(): axes whose bins have exactly
+    /// the same edges share one instance, so that booking many histograms
+    /// with the same binning costs the lookup structures once, and checking
+    /// two axes for compatible binning is usually a pointer comparison.
+    ///
+    /// Instances are created and looked up under a lock, so axes may be
+    /// created on several threads.
+    class Binning {
+    public:
+
+      typedef std::shared_ptr<const Binning> Ptr;
+
+      /// @brief The shared 1D binning with searcher edges @a edges and cell indices @a indexes
+      ///
+      /// @a indexes has one more entry than @a edges: the underflow, the
+      /// cells between the edges, and the overflow.
+      static Ptr get(const std::vector<double>& edges, const std::vector<long>& indexes);
+
+      /// @brief The shared 2D binning with cut lists @a xedges and @a yedges
+      ///
+      /// @a indexes has xedges.size() * yedges.size() entries, indexed by
+      /// y * xedges.size() + x for the cell above edges x and y.
+      static Ptr get(const std::vector<double>& xedges, const std::vector<double>& yedges,
+                     const std::vector<long>& indexes);
+
+      /// The shared binning of an empty axis
+      static Ptr empty();
+
+      /// Number of distinct binnings currently in use
+      static size_t numInstances();
+
+
+      /// Searcher of the (x-axis) edges
+      const BinSearcher& xSearcher() const { return _xsearcher; }
+
+      /// Searcher of the y-axis edges, with no finite edges for 1D binnings
+      const BinSearcher& ySearcher() const { return _ysearcher; }
+
+      /// Map from searcher cells to bin indices, with -1 for gaps and outflows
+      const std::vector<long>& indexes() const { return _indexes; }
+
+      /// Heap bytes used by this binning, excluding the object itself
+      size_t heapSize() const {
+        return _xsearcher.heapSize() + _ysearcher.heapSize() + Utils::heapSize(_indexes);
+      }
+
+      Binning(const Binning&) = delete;
+      Binning& operator = (const Binning&) = delete;
+
+
+    private:
+
+      /// Construct, via get() only
+      Binning(const std::vector<double>& xedges, const std::vector<double>& yedges,
+              const std::vector<long>& indexes, bool is2d);
+
+      /// Look up or create the shared instance
+      static Ptr _get(const std::vector<double>& xedges, const std::vector<double>& yedges,
+                      const std::vector<long>& indexes, bool is2d);
+
+      /// Whether this binning was made from exactly these edges and indices
+      bool _matches(const std::vector<double>& xedges, const std::vector<double>& yedges,
+                    const std::vector<long>& indexes, bool is2d) const;
+
+      bool _is2d;
+      size_t _hash;
+      BinSearcher _xsearcher, _ysearcher;
+      std::vector<long> _indexes;
+
+    };
+
+
+  }
+}
+
+#endif
@@ -0,0 +1,103 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_MEMORYUSAGE_H
+#define YODA_MEMORYUSAGE_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <map>
+
+namespace YODA {
+
+
+  /// @brief Breakdown of the memory used by an analysis object, in bytes
+  ///
+  /// Heap sizes are estimated from container capacities plus the usual
+  /// allocation overheads of the GNU and LLVM standard libraries' nodes and
+  /// shared-pointer control blocks, not from the allocator itself: good for
+  /// seeing where memory goes and comparing layouts, but approximate.
+  /// The bin lookup structures shared by axes with the same binning are
+  /// divided evenly between the axes sharing them.
+  struct MemoryUsage {
+
+    /// The object itself, including its bin axis but not what either points to
+    size_t object = 0;
+
+    /// Bins, under/overflow distributions and scatter points
+    size_t bins = 0;
+
+    /// Bin lookup structures: BinSearcher edges and estimators, and bin index maps
+    size_t index = 0;
+
+    /// Annotation keys and values
+    size_t annotations = 0;
+
+    /// Scatter points' error breakdowns and their variation-name tables
+    size_t errors = 0;
+
+    /// Sum of all the parts
+    size_t total() const {
+      return object + bins + index + annotations + errors;
+    }
+
+    /// Add the parts of another breakdown to these
+    MemoryUsage& operator += (const MemoryUsage& other) {
+      object += other.object;
+      bins += other.bins;
+      index += other.index;
+      annotations += other.annotations;
+      errors += other.errors;
+      return *this;
+    }
+
+  };
+
+
+  namespace Utils {
+
+
+    /// Bookkeeping per node of a std::map: colour and parent, left and right pointers
+    const size_t MAP_NODE_OVERHEAD = 4*sizeof(void*);
+
+    /// Bookkeeping per node of a std::unordered_map: next pointer and cached hash
+    const size_t HASH_NODE_OVERHEAD = 2*sizeof(void*);
+
+    /// Control block of a std::make_shared allocation: vtable pointer and two counts
+    const size_t SHARED_PTR_OVERHEAD = 2*sizeof(void*);
+
+
+    /// Heap bytes used by a vector's storage, not including what the elements point to
+    template <typename T>
+    inline size_t heapSize(const std::vector<T>& v) {
+      return v.capacity() * sizeof(T);
+    }
+
+    /// Heap bytes used by a bit-packed vector of bools
+    inline size_t heapSize(const std::vector<bool>& v) {
+      const size_t wordbits = 8*sizeof(unsigned long);
+      return (v.capacity() + wordbits - 1) / wordbits * sizeof(unsigned long);
+    }
+
+    /// Heap bytes used by a string, zero if it fits in the short-string buffer
+    inline size_t heapSize(const std::string& s) {
+      static const size_t ssocapacity = std::string().capacity();
+      return s.capacity() > ssocapacity ? s.capacity() + 1 : 0;
+    }
+
+    /// Heap bytes used by a map of strings, including its nodes
+    inline size_t heapSize(const std::map<std::string, std::string>& m) {
+      size_t rtn = 0;
+      for (const auto& kv : m)
+        rtn += MAP_NODE_OVERHEAD + sizeof(kv) + heapSize(kv.first) + heapSize(kv.second);
+      return rtn;
+    }
+
+
+  }
+}
+
+#endif
@@ -0,0 +1,103 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#ifndef YODA_VARIATIONTABLE_H
+#define YODA_VARIATIONTABLE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+#include "YODA/Utils/MemoryUsage.h"
+
+namespace YODA {
+  namespace Utils {
+
+
+    /// @brief Table of interned error-variation names with dense integer IDs
+    ///
+    /// Each Scatter owns one of these and shares it with its points, so that
+    /// each point can store its error breakdown as a contiguous array indexed
+    /// by variation ID rather than repeating every source name per point. The
+    /// nominal (total) error source "" always has ID 0.
+    class VariationTable {
+    public:
+
+      /// Default constructor, registering the nominal source as ID 0
+      VariationTable() {
+        _names.push_back("");
+        _ids[""] = 0;
+      }
+
+      /// Number of registered variations, including the nominal
+      size_t size() const { return _names.size(); }
+
+      /// All variation names, ordered by ID
+      const std::vector<std::string>& names() const { return _names; }
+
+      /// Name of the variation with ID @a id
+      const std::string& name(size_t id) const {
+        if (id >= _names.size()) throw std::range_error("Requested variation ID larger than table size");
+        return _names[id];
+      }
+
+      /// Does this table know about variation @a name?
+      bool has(const std::string& name) const {
+        return _ids.find(name) != _ids.end();
+      }
+
+      /// @brief ID of the variation called @a name, or size() if it is not registered
+      ///
+      /// Returning an out-of-range ID rather than throwing lets lookups on the
+      /// point side fall straight through to their usual "no such key" handling.
+      size_t find(const std::string& name) const {
+        if (name.empty()) return 0;
+        const auto it = _ids.find(name);
+        return (it != _ids.end()) ? it->second : _names.size();
+      }
+
+      /// ID of the variation called @a name, registering it if necessary
+      size_t intern(const std::string& name) {
+        if (name.empty()) return 0;
+        const auto it = _ids.find(name);
+        if (it != _ids.end()) return it->second;
+        const size_t id = _names.size();
+        _names.push_back(name);
+        _ids[name] = id;
+        return id;
+      }
+
+      /// Register all the variations of @a other, returning the map from its IDs to ours
+      std::vector<size_t> intern(const VariationTable& other) {
+        std::vector<size_t> idmap;
+        idmap.reserve(other.size());
+        for (const std::string& name : other.names()) idmap.push_back(intern(name));
+        return idmap;
+      }
+
+      /// Heap bytes used by the names and the lookup table, excluding the table itself
+      size_t heapSize() const {
+        size_t rtn = Utils::heapSize(_names) + _ids.bucket_count()*sizeof(void*);
+        for (const std::string& name : _names) rtn += Utils::heapSize(name);
+        for (const auto& kv : _ids) rtn += HASH_NODE_OVERHEAD + sizeof(kv) + Utils::heapSize(kv.first);
+        return rtn;
+      }
+
+
+    private:
+
+      /// Variation names, indexed by ID
+      std::vector<std::string> _names;
+
+      /// Reverse lookup from variation name to ID
+      std::unordered_map<std::string, size_t> _ids;
+
+    };
+
+
+  }
+}
+
+#endif
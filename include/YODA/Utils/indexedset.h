@@ -6,24 +6,56 @@
 #ifndef YODA_INDEXEDSET_H
 #define YODA_INDEXEDSET_H
 
-#include <set>
+#include <vector>
+#include <algorithm>
+#include <utility>
 #include <stdexcept>
-#include <iostream>
 
 namespace YODA {
   namespace Utils {
 
 
-    /// @brief Specialisation of std::set to allow indexed access to ordered set elements
+    /// @brief Ordered set of unique elements with constant-time indexed access
     ///
-    /// The STL set is already implemented in an ordered style, so this specialisation is
-    /// implemented in a super-simple way by just iterating over the set elements until
-    /// the desired index is reached. This is not scalable, of course, but this implementation
-    /// is for use with histograms, which will not have squillions of entries.
+    /// Provides the commonly used parts of the std::set interface, but the
+    /// elements are kept in a contiguous sorted vector: lookups are binary
+    /// searches and operator[] is a direct (rank) access. Single insertions
+    /// and erasures move the later elements along, so bulk-fill with the range
+    /// insert where possible, which only sorts once.
+    ///
+    /// As with std::set, the elements can't be modified in place since that
+    /// could change their ordering: all iterators are const.
     template <typename T>
-    class indexedset : public std::set<T> {
+    class indexedset {
     public:
 
+      typedef T key_type;
+      typedef T value_type;
+      typedef size_t size_type;
+      typedef typename std::vector<T>::const_iterator const_iterator;
+      typedef const_iterator iterator;
+      typedef typename std::vector<T>::const_reverse_iterator const_reverse_iterator;
+      typedef const_reverse_iterator reverse_iterator;
+
+
+      /// @name Iterators and size
+      //@{
+
+      const_iterator begin() const { return _vals.begin(); }
+      const_iterator end() const { return _vals.end(); }
+      const_iterator cbegin() const { return _vals.begin(); }
+      const_iterator cend() const { return _vals.end(); }
+      const_reverse_iterator rbegin() const { return _vals.rbegin(); }
+      const_reverse_iterator rend() const { return _vals.rend(); }
+
+      size_t size() const { return _vals.size(); }
+      bool empty() const { return _vals.empty(); }
+
+      //@}
+
+
+      /// @name Lookup
+      //@{
 
       /// @brief Const index-access operator
       ///
@@ -32,16 +64,86 @@ namespace YODA {
         if (index >= this->size()) {
           throw std::range_error("Requested index larger than indexed set size");
         }
-        size_t i = 0;
-        for (typename indexedset<T>::const_iterator it = this->begin(); it != this->end(); ++it) {
-          // std::cout << i << "/" << index << ", " << (*it) << std::endl;
-          if (i == index) return *it;
-          i += 1;
-        }
-        // This should never be called: just keeping the compiler happy:
-        return (*this)[0];
+        return _vals[index];
+      }
+
+      const_iterator lower_bound(const T& val) const {
+        return std::lower_bound(_vals.begin(), _vals.end(), val);
+      }
+
+      const_iterator upper_bound(const T& val) const {
+        return std::upper_bound(_vals.begin(), _vals.end(), val);
+      }
+
+      const_iterator find(const T& val) const {
+        const_iterator it = lower_bound(val);
+        return (it != _vals.end() && !(val < *it)) ? it : _vals.end();
+      }
+
+      size_t count(const T& val) const {
+        return (find(val) != _vals.end()) ? 1 : 0;
+      }
+
+      /// Position of @a val in the ordering, or size() if it is not in the set
+      size_t index(const T& val) const {
+        return find(val) - _vals.begin();
       }
 
+      //@}
+
+
+      /// @name Modifiers
+      //@{
+
+      /// Insert @a val if not already present, returning its position and whether it was added
+      std::pair<const_iterator,bool> insert(const T& val) {
+        typename std::vector<T>::iterator it = std::lower_bound(_vals.begin(), _vals.end(), val);
+        if (it != _vals.end() && !(val < *it)) return std::make_pair(const_iterator(it), false);
+        it = _vals.insert(it, val);
+        return std::make_pair(const_iterator(it), true);
+      }
+
+      /// Insert a range of values, sorting and de-duplicating once
+      template <typename ITER>
+      void insert(ITER first, ITER last) {
+        const size_t nold = _vals.size();
+        _vals.insert(_vals.end(), first, last);
+        const typename std::vector<T>::iterator mid = _vals.begin() + nold;
+        if (!std::is_sorted(mid, _vals.end())) std::stable_sort(mid, _vals.end());
+        if (nold > 0 && mid != _vals.end() && !(*(mid-1) < *mid))
+          std::inplace_merge(_vals.begin(), mid, _vals.end());
+        _vals.erase(std::unique(_vals.begin(), _vals.end(), _equiv), _vals.end());
+      }
+
+      /// Remove @a val, returning the number of elements erased
+      size_t erase(const T& val) {
+        const_iterator it = find(val);
+        if (it == _vals.end()) return 0;
+        erase(it);
+        return 1;
+      }
+
+      /// Remove the element at @a pos
+      const_iterator erase(const_iterator pos) {
+        return _vals.erase(_vals.begin() + (pos - _vals.begin()));
+      }
+
+      void clear() { _vals.clear(); }
+
+      void swap(indexedset<T>& other) { _vals.swap(other._vals); }
+
+      //@}
+
+
+      bool operator == (const indexedset<T>& other) const { return _vals == other._vals; }
+      bool operator != (const indexedset<T>& other) const { return _vals != other._vals; }
+
+
+    private:
+
+      static bool _equiv(const T& a, const T& b) { return !(a < b) && !(b < a); }
+
+      std::vector<T> _vals;
 
     };
 
@@ -18,8 +18,8 @@ namespace YODA {
     /// @brief Specialisation of std::vector to allow indexed access to ordered elements
     ///
     /// @warning This still scales as n^2 log n or so, if inserting n
-    /// elements. Prefer to populate a whole std::vector first, then add, so the
-    /// sorting/searchin only needs to be done once.
+    /// elements one at a time. Prefer to populate a whole std::vector first,
+    /// then add it with the range insert, so the sorting only needs to be done once.
     ///
     /// @todo Need to template on the value-comparison definition?
     /// @todo Generalise the type of source container for constructor argument
@@ -33,7 +33,8 @@ namespace YODA {
       /// Conversion from std::vector
       sortedvector(const std::vector<T> & vec)
         : std::vector<T>(vec) {
-        std::sort(this->begin(), this->end());
+        if (!std::is_sorted(this->begin(), this->end()))
+          std::stable_sort(this->begin(), this->end());
       }
 
       /// Insertion operator (push_back should not be used!)
@@ -46,6 +47,22 @@ namespace YODA {
         std::vector<T>::insert(std::upper_bound(std::vector<T>::begin(), std::vector<T>::end(), val), val);
       }
 
+      /// @brief Range insertion, appending then sorting and merging once
+      ///
+      /// Already-ordered input that belongs after the existing elements (the
+      /// usual case when filling from bins or a file) only costs a linear
+      /// check. Equal elements keep their insertion order, as for insert(val).
+      template <typename ITER>
+      void insert(ITER first, ITER last) {
+        const size_t nold = this->size();
+        std::vector<T>::insert(std::vector<T>::end(), first, last);
+        const typename std::vector<T>::iterator mid = std::vector<T>::begin() + nold;
+        if (!std::is_sorted(mid, std::vector<T>::end()))
+          std::stable_sort(mid, std::vector<T>::end());
+        if (nold > 0 && mid != std::vector<T>::end() && *mid < *(mid-1))
+          std::inplace_merge(std::vector<T>::begin(), mid, std::vector<T>::end());
+      }
+
 
     private:
 
@@ -17,14 +17,30 @@
 #include "YODA/Scatter3D.h"
 #include "YODA/Utils/Traits.h"
 #include <type_traits>
+#include <algorithm>
 #include <fstream>
 #include <ostream>
 #include <string>
+#include <memory>
 
 namespace YODA {
 
 
-  /// Pure virtual base class for various output writers.
+  /// Output settings for a writer made by mkWriter(name, opts)
+  struct WriterOptions {
+    int precision = 6; //< significant digits of numerical quantities
+    bool compress = false; //< gzip stream output, also implied by a .gz name; files are compressed by their name
+    size_t nthreads = 1; //< number of threads formatting the objects, cf. Writer::setThreads()
+  };
+
+
+  /// @brief Pure virtual base class for various output writers.
+  ///
+  /// A writer's precision and compression settings are per-instance state, so
+  /// an instance must not be used from several threads at once. The create()
+  /// functions of the concrete writers, and hence mkWriter(name), return an
+  /// instance private to the calling thread; mkWriter(name, opts) makes a new,
+  /// independently configured one.
   class Writer {
   public:
 
@@ -125,12 +141,11 @@ namespace YODA {
           const size_t lastdot = filename.find_last_of(".");
           std::string fmt = Utils::toLower(lastdot == std::string::npos ? filename : filename.substr(lastdot+1));
           const bool compress = (fmt == "gz");
-          useCompression(compress);
           //
           std::ofstream stream;
           stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
           stream.open(filename.c_str());
-          write(stream, vec);
+          _write(stream, vec, compress);
         } catch (std::ofstream::failure& e) {
           throw WriteError("Writing to filename " + filename + " failed: " + e.what());
         }
@@ -157,9 +172,26 @@ namespace YODA {
       _compress = compress;
     }
 
+    /// @brief Format the objects on @a nthreads threads when writing several
+    ///
+    /// Each thread formats, and if compressing also compresses, a share of the
+    /// objects into its own buffer, and the buffers are written out in order by
+    /// the calling thread. The output is identical to that of a single thread,
+    /// except that compressed output is made of one gzip member per buffer.
+    void setThreads(size_t nthreads) {
+      _nthreads = std::max<size_t>(nthreads, 1);
+    }
+
 
   protected:
 
+    /// Write out @a aos to @a stream, compressing it if @a compress is true
+    void _write(std::ostream& stream, const std::vector<const AnalysisObject*>& aos, bool compress);
+
+    /// Write out @a aos to @a stream using _nthreads threads, cf. setThreads()
+    void _writeParallel(std::ostream& stream, const std::vector<const AnalysisObject*>& aos, bool compress);
+
+
     /// @name Main writer elements
     //@{
 
@@ -200,17 +232,29 @@ namespace YODA {
 
 
     /// Output precision
-    int _precision;
+    int _precision = 6;
 
     /// Compress the output?
-    bool _compress;
+    bool _compress = false;
+
+    /// Number of threads for formatting the output
+    size_t _nthreads = 1;
 
   };
 
 
-  /// Factory function to make a writer object by format name or a filename
+  /// @brief Factory function to get a writer object by format name or a filename
+  ///
+  /// The writer is shared by all calls from the same thread, and its
+  /// precision and compression are reset to the defaults for @a format_name.
   Writer& mkWriter(const std::string& format_name);
 
+  /// @brief Factory function to make a new writer object by format name or a filename
+  ///
+  /// The writer is owned by the caller and not shared, so writers made this
+  /// way can be used concurrently with any settings.
+  std::unique_ptr<Writer> mkWriter(const std::string& format_name, const WriterOptions& opts);
+
 
 }
 
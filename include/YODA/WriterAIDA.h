@@ -16,7 +16,10 @@ namespace YODA {
   class WriterAIDA : public Writer {
   public:
 
-    /// Singleton creation function
+    /// Constructor of an independent instance
+    WriterAIDA() { }
+
+    /// Creation function for the calling thread's shared instance
     static Writer& create();
 
     // Include definitions of all write methods (all fulfilled by Writer::write(...))
@@ -37,12 +40,6 @@ namespace YODA {
     void writeScatter2D(std::ostream& stream, const Scatter2D& s);
     void writeScatter3D(std::ostream& stream, const Scatter3D& s);
 
-
-  private:
-
-    /// Private since it's a singleton.
-    WriterAIDA() { }
-
   };
 
 
@@ -16,7 +16,10 @@ namespace YODA {
   class WriterFLAT : public Writer {
   public:
 
-    /// Singleton creation function
+    /// Constructor of an independent instance
+    WriterFLAT() { }
+
+    /// Creation function for the calling thread's shared instance
     static Writer& create();
 
     // Include definitions of all write methods (all fulfilled by Writer::write(...))
@@ -39,9 +42,6 @@ namespace YODA {
 
     void _writeAnnotations(std::ostream& os, const AnalysisObject& ao);
 
-    /// Private since it's a singleton.
-    WriterFLAT() { }
-
   };
 
 
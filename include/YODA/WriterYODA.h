@@ -16,7 +16,10 @@ namespace YODA {
   class WriterYODA : public Writer {
   public:
 
-    /// Singleton creation function
+    /// Constructor of an independent instance
+    WriterYODA() { }
+
+    /// Creation function for the calling thread's shared instance
     static Writer& create();
 
     // Include definitions of all write methods (all fulfilled by Writer::write(...))
@@ -37,10 +40,7 @@ namespace YODA {
 
   private:
 
-    void _writeAnnotations(std::ostream& os, const AnalysisObject& ao);
-
-    /// Private since it's a singleton.
-    WriterYODA() { }
+    void _writeAnnotations(std::ostream& os, const AnalysisObject& ao, bool skipErrorBreakdown=false);
 
   };
 
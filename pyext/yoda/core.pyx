@@ -6,6 +6,7 @@ from libcpp.string cimport string
 from libcpp.vector cimport vector
 from libcpp.pair cimport pair
 from libcpp.map cimport map
+from libcpp.memory cimport unique_ptr
 
 ## YODA mapping imports
 cimport yoda.declarations as c
@@ -20,7 +21,27 @@ def version():
     "Return YODA library version as a string"
     return c.version()
 
+def stats_enabled():
+    "Return whether YODA was built with instrumentation counters, by configuring with --enable-stats"
+    return c.Stats_enabled()
+
+def stats():
+    """Return a dict of the instrumentation counters and timers, the latter in seconds.
+
+    The values are all zero unless YODA was built with --enable-stats."""
+    cdef dict vals = c.Stats_values()
+    return {k.decode("utf-8") : v for k, v in vals.items()}
+
+def reset_stats():
+    "Zero the instrumentation counters and timers"
+    c.Stats_reset()
+
+def stats_summary():
+    "Return a readable summary of the instrumentation counters and timers"
+    return c.Stats_summary().decode("utf-8")
+
 include "include/Errors.pyx"
+include "include/ArrayView.pyx"
 include "include/Dbn0D.pyx"
 include "include/Dbn1D.pyx"
 include "include/Dbn2D.pyx"
@@ -38,6 +59,8 @@ include "include/ProfileBin2D.pyx"
 include "include/HistoBin2D.pyx"
 include "include/Histo2D.pyx"
 include "include/Profile2D.pyx"
+include "include/Sampler.pyx"
+include "include/Integrals.pyx"
 include "include/Point.pyx"
 include "include/Point1D.pyx"
 include "include/Point2D.pyx"
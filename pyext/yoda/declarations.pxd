@@ -1,13 +1,21 @@
 from libcpp.map cimport map
 from libcpp.pair cimport pair
 from libcpp.vector cimport vector
+from libcpp.memory cimport unique_ptr
 from libcpp cimport bool
 from libcpp.string cimport string
+from libc.stdint cimport uint64_t
 from cython.operator cimport dereference as deref
 
 cdef extern from "YODA/Config/YodaConfig.h" namespace "YODA":
      string version()
 
+cdef extern from "YODA/Stats.h":
+     bool Stats_enabled "YODA::Stats::enabled" ()
+     map[string, double] Stats_values "YODA::Stats::values" ()
+     void Stats_reset "YODA::Stats::reset" ()
+     string Stats_summary "YODA::Stats::summary" ()
+
 
 # Import the error handling C++ routine
 cdef extern from "errors.hh":
@@ -49,6 +57,7 @@ cdef extern from "YODA/Dbn0D.h" namespace "YODA":
         double effNumEntries() except +yodaerr
         double sumW() except +yodaerr
         double sumW2() except +yodaerr
+        double* sumsPtr()
 
         double errW() except +yodaerr
         double relErrW() except +yodaerr
@@ -87,6 +96,7 @@ cdef extern from "YODA/Dbn1D.h" namespace "YODA":
         double sumW2() except +yodaerr
         double sumWX() except +yodaerr
         double sumWX2() except +yodaerr
+        double* sumsPtr()
 
         Dbn1D operator+ (Dbn1D)
         Dbn1D operator- (Dbn1D)
@@ -133,6 +143,7 @@ cdef extern from "YODA/Dbn2D.h" namespace "YODA":
         double sumWY() except +yodaerr
         double sumWY2() except +yodaerr
         double sumWXY() except +yodaerr
+        double* sumsPtr()
 
         # Operators
         void flipXY() except +yodaerr
@@ -204,6 +215,7 @@ cdef extern from "YODA/Dbn3D.h" namespace "YODA":
         double sumWYZ()
 
         double sumWXYZ()
+        double* sumsPtr()
 
         # Operators
         void flipXY()
@@ -270,6 +282,7 @@ cdef extern from "YODA/Point1D.h" namespace "YODA":
         Point1D (double x, double exminus, double explus, string source) except +yodaerr
 
         double x() except +yodaerr
+        double* valPtr(size_t i) except +yodaerr
         void setX(double x) except +yodaerr
 
         pair[double,double] xErrs() except +yodaerr
@@ -309,6 +322,7 @@ cdef extern from "YODA/Point2D.h" namespace "YODA":
 
         double x() except +yodaerr
         double y() except +yodaerr
+        double* valPtr(size_t i) except +yodaerr
         void setX(double x) except +yodaerr
         void setY(double y) except +yodaerr
         pair[double,double] xy() except +yodaerr
@@ -362,6 +376,7 @@ cdef extern from "YODA/Point3D.h" namespace "YODA":
         double x() except +yodaerr
         double y() except +yodaerr
         double z() except +yodaerr
+        double* valPtr(size_t i) except +yodaerr
         void setX(double x) except +yodaerr
         void setY(double y) except +yodaerr
         void setZ(double z) except +yodaerr
@@ -435,6 +450,7 @@ cdef extern from "YODA/Bin1D.h" namespace "YODA":
         # void scaleX(double scale) except +yodaerr
         void reset()  except +yodaerr
 
+        DBN& dbn()
         pair[double, double] edges() except +yodaerr
 
         double xMin() except +yodaerr
@@ -479,6 +495,7 @@ cdef extern from "YODA/Bin2D.h" namespace "YODA":
         # void scaleXY(double, double) except +yodaerr
         void reset()  except +yodaerr
 
+        DBN& dbn()
         pair[double, double] xEdges() except +yodaerr
         pair[double, double] yEdges() except +yodaerr
 
@@ -648,6 +665,14 @@ cdef extern from "YODA/ProfileBin2D.h" namespace "YODA":
 
 # AnalysisObject {{{
 cdef extern from "YODA/AnalysisObject.h" namespace "YODA":
+    cdef cppclass MemoryUsage:
+        size_t object
+        size_t bins
+        size_t index
+        size_t annotations
+        size_t errors
+        size_t total()
+
     cdef cppclass AnalysisObject:
         # Constructors
         AnalysisObject(string type, string path, string title) except +yodaerr
@@ -661,6 +686,9 @@ cdef extern from "YODA/AnalysisObject.h" namespace "YODA":
         ## Data object fill- or plot-space dimension
         int dim() except +yodaerr
 
+        ## Memory breakdown
+        MemoryUsage memoryUsage() except +yodaerr
+
         ## Annotations
         vector[string] annotations() except +yodaerr
         bool hasAnnotation(string key) except +yodaerr
@@ -704,7 +732,7 @@ cdef extern from "YODA/Counter.h" namespace "YODA":
 
         void reset() except +yodaerr
 
-        void fill(double weight, double fraction) except +yodaerr
+        void fill(double weight, double fraction) except +yodaerr nogil
 
         unsigned long numEntries() except +yodaerr
         double effNumEntries() except +yodaerr
@@ -796,6 +824,20 @@ cdef extern from "YODA/Scatter1D.h" namespace "YODA":
     Scatter1D mkScatter_Scatter1D "YODA::mkScatter" (const Scatter1D&) except +yodaerr
 
 
+# CovarianceMatrix {{{
+cdef extern from "YODA/CovarianceMatrix.h" namespace "YODA":
+    cdef cppclass CovarianceMatrix:
+        size_t size()
+        const vector[double]& data()
+
+    cdef cppclass CovarianceSplit:
+        CovarianceMatrix total
+        CovarianceMatrix correlated
+        CovarianceMatrix uncorrelated
+
+#}}} CovarianceMatrix
+
+
 # Scatter2D {{{
 cdef extern from "YODA/Scatter2D.h" namespace "YODA":
     cdef cppclass Scatter2D(AnalysisObject):
@@ -842,6 +884,7 @@ cdef extern from "YODA/Scatter2D.h" namespace "YODA":
         void parseVariations() except +yodaerr
         vector[string] variations() except +yodaerr
         
+        CovarianceSplit covariance(bool, size_t) except +yodaerr
         vector[vector[double]] covarianceMatrix(bool) except +yodaerr
 
     void Scatter2D_transformX "YODA::transformX" (Scatter2D&, dbl_dbl_fptr)
@@ -957,7 +1000,7 @@ cdef extern from "YODA/Histo1D.h" namespace "YODA":
 
         void reset() except +yodaerr
 
-        void fill(double x, double weight, double fraction) except +yodaerr
+        void fill(double x, double weight, double fraction) except +yodaerr nogil
         void fillBin(size_t i, double weight, double fraction) except +yodaerr
 
         void scaleW(double s) except +yodaerr
@@ -990,8 +1033,8 @@ cdef extern from "YODA/Histo1D.h" namespace "YODA":
 
         # Whole histo data
         double integral(bool)
-        double integralTo(int, bool)
-        double integralRange(int, int)
+        double integralTo(int, bool) except +yodaerr
+        double integralRange(int, int) except +yodaerr
 
         unsigned long numEntries(bool)
         double effNumEntries(bool)
@@ -1057,7 +1100,7 @@ cdef extern from "YODA/Histo2D.h" namespace "YODA":
 
         void reset() except +yodaerr
 
-        void fill(double x, double y, double weight, double fraction) except +yodaerr
+        void fill(double x, double y, double weight, double fraction) except +yodaerr nogil
         void fillBin(size_t i, double weight, double fraction) except +yodaerr
 
         void normalize(double normto, bool includeoverflows) except +yodaerr
@@ -1136,6 +1179,43 @@ cdef extern from "YODA/Scatter3D.h" namespace "YODA":
 # Histo2D }}}
 
 
+# Sampler {{{
+cdef extern from "YODA/Sampler.h" namespace "YODA":
+    cdef cppclass Histo1DSampler:
+        Histo1DSampler(const Histo1D&, uint64_t) except +yodaerr
+        void seed(uint64_t)
+        size_t numBins()
+        double sample() nogil
+        void sample(double*, size_t) nogil
+
+    cdef cppclass Histo2DSampler:
+        Histo2DSampler(const Histo2D&, uint64_t) except +yodaerr
+        void seed(uint64_t)
+        size_t numBins()
+        pair[double, double] sample() nogil
+        void sample(double*, double*, size_t) nogil
+# Sampler }}}
+
+
+# Integrals {{{
+cdef extern from "YODA/Integrals.h" namespace "YODA":
+    cdef cppclass Histo1DIntegrals:
+        Histo1DIntegrals(const Histo1D&) except +yodaerr
+        size_t numBins()
+        double integralRange(size_t, size_t) except +yodaerr
+        double integralTo(size_t, bool) except +yodaerr
+        double integral()
+
+    cdef cppclass Histo2DIntegrals:
+        Histo2DIntegrals(const Histo2D&) except +yodaerr
+        size_t numCellsX()
+        size_t numCellsY()
+        double integralRange(size_t, size_t, size_t, size_t) except +yodaerr
+        double integralTo(size_t, size_t) except +yodaerr
+        double integral()
+# Integrals }}}
+
+
 
 
 
@@ -1168,7 +1248,7 @@ cdef extern from "YODA/Profile1D.h" namespace "YODA":
 
         void reset() except +yodaerr
 
-        void fill(double x, double y, double weight, double fraction) except +yodaerr
+        void fill(double x, double y, double weight, double fraction) except +yodaerr nogil
         void fillBin(size_t i, double y, double weight, double fraction) except +yodaerr
 
         void scaleW(double s) except +yodaerr
@@ -1189,7 +1269,7 @@ cdef extern from "YODA/Profile1D.h" namespace "YODA":
 
         size_t numBins() except +yodaerr
 
-        vector[ProfileBin1D] bins() #except +yodaerr
+        vector[ProfileBin1D]& bins() #except +yodaerr
         int binIndexAt(double x) except +yodaerr
         const ProfileBin1D& bin(size_t ix) #except +yodaerr
         const ProfileBin1D& binAt(double x) #except +yodaerr
@@ -1260,7 +1340,7 @@ cdef extern from "YODA/Profile2D.h" namespace "YODA":
 
         void reset() except +yodaerr
 
-        void fill(double x, double y, double z, double weight, double fraction) except +yodaerr
+        void fill(double x, double y, double z, double weight, double fraction) except +yodaerr nogil
         void fillBin(size_t i, double z, double weight, double fraction) except +yodaerr
 
         void scaleW(double s) except +yodaerr
@@ -1356,6 +1436,16 @@ cdef extern from "YODA/Reader.h" namespace "YODA":
 
 cdef extern from "YODA/ReaderYODA.h" namespace "YODA":
     Reader& ReaderYODA_create "YODA::ReaderYODA::create" ()
+    cdef cppclass ReaderYODA_ScanRecord "YODA::ReaderYODA::ScanRecord":
+        string path
+        string type
+        size_t begin
+        size_t end
+        size_t numLines
+        size_t numDataLines
+        size_t numBins
+        string total
+    vector[ReaderYODA_ScanRecord] ReaderYODA_scan "YODA::ReaderYODA::scan" (string&, bool) except +yodaerr
 
 cdef extern from "YODA/ReaderFLAT.h" namespace "YODA":
     Reader& ReaderFLAT_create "YODA::ReaderFLAT::create" ()
@@ -1375,6 +1465,13 @@ cdef extern from "YODA/Writer.h" namespace "YODA":
         void write(ostringstream&, vector[AnalysisObject*]&) except +yodaerr
         void write_to_file "YODA::Writer::write" (string&, vector[AnalysisObject*]&) except +yodaerr
 
+    cdef cppclass WriterOptions:
+        int precision
+        bool compress
+        size_t nthreads
+
+    unique_ptr[Writer] Writer_make "YODA::mkWriter" (string&, WriterOptions&) except +yodaerr
+
 cdef extern from "YODA/WriterYODA.h" namespace "YODA":
     Writer& WriterYODA_create "YODA::WriterYODA::create" ()
 
@@ -1390,6 +1487,35 @@ cdef extern from "YODA/Reader.h" namespace "YODA":
 # Streams }}}
 
 
+cdef extern from "YODA/FillText.h" namespace "YODA":
+    size_t fillFromText(AnalysisObject&, string&, size_t) except +yodaerr nogil
+
+cdef extern from "YODA/Convert.h" namespace "YODA":
+    cdef cppclass ConvertOptions:
+        string inFormat
+        string outFormat
+        string match
+        string unmatch
+        bool asScatters
+        size_t nthreads
+    cdef cppclass ConvertStats:
+        string infile
+        string outfile
+        size_t numObjects
+        size_t inBytes
+        size_t outBytes
+        double seconds
+        string error
+    vector[ConvertStats] convert(vector[pair[string,string]]&, ConvertOptions&) except +yodaerr nogil
+
+cdef extern from "YODA/Serialize.h" namespace "YODA":
+    string serialize(const AnalysisObject&) except +yodaerr
+    AnalysisObject* deserialize(const char*, size_t) except +yodaerr
+
+cdef extern from "YODA/LiveExport.h" namespace "YODA":
+    vector[AnalysisObject*] readLive(string&) except +yodaerr
+
+
 
 # Axis1D {{{
 cdef extern from "YODA/Axis1D.h" namespace "YODA":
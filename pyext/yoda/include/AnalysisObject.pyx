@@ -32,6 +32,14 @@ cdef class AnalysisObject(util.Base):
         "Fill dimension or plot dimension of this object, for fillables and scatters respectively"
         return self.aoptr().dim()
 
+    def memoryUsage(self):
+        """Approximate memory used by this object, as a dict of bytes by component:
+        object, bins, index (bin lookup structures), annotations, errors
+        (error breakdowns) and their total."""
+        cdef c.MemoryUsage m = self.aoptr().memoryUsage()
+        return {"object" : m.object, "bins" : m.bins, "index" : m.index,
+                "annotations" : m.annotations, "errors" : m.errors, "total" : m.total()}
+
     #@property
     def annotations(self):
         """() -> list[str]
@@ -153,5 +161,27 @@ cdef class AnalysisObject(util.Base):
         return "<%s '%s'>" % (self.__class__.__name__, self.path)
 
 
+    def __reduce__(self):
+        """Pickling support, via the compact binary encoding of the C++ object
+        rather than YODA text: see toBytes()."""
+        return (_aobject_from_bytes, (type(self), self.toBytes()))
+
+    def toBytes(self):
+        """() -> bytes
+        Encode this object's annotations, binning and statistics, or points and
+        errors, as compact native-endian binary data. This is much faster than
+        writing YODA text, and is what pickle uses, but is only meant for
+        passing objects between processes running the same YODA version."""
+        cdef string s = c.serialize(deref(self.aoptr()))
+        return s.data()[:s.size()]
+
+
+def _aobject_from_bytes(cls, data):
+    "Decode an analysis object of type cls from the output of AnalysisObject.toBytes()"
+    cdef const unsigned char[::1] buf = data
+    cdef c.AnalysisObject* ao = c.deserialize(<const char*> &buf[0] if buf.shape[0] else NULL, buf.shape[0])
+    return cutil.new_owned_cls(cls, ao)
+
+
 ## Convenience alias
 AO = AnalysisObject
@@ -0,0 +1,97 @@
+from cpython.buffer cimport PyBUF_WRITABLE, PyBUF_FORMAT, PyBUF_ND, PyBUF_STRIDES
+
+cdef class ArrayView:
+    """
+    Strided 1D view of doubles stored inside a YODA object, e.g. the sumW of
+    every bin of a histogram, exposed through the buffer protocol so that
+    numpy.asarray() and memoryview() can use it without copying.
+
+    The view keeps its owning object alive, but is invalidated by anything
+    which reallocates the owner's storage, such as adding, removing or
+    merging bins or points.
+    """
+
+    cdef object _owner
+    cdef char* _data
+    cdef Py_ssize_t _shape[1]
+    cdef Py_ssize_t _strides[1]
+    cdef bint _readonly
+    cdef vector[double] _store
+    cdef double _empty
+
+    def __getbuffer__(self, Py_buffer* buf, int flags):
+        if (flags & PyBUF_WRITABLE) and self._readonly:
+            raise BufferError("This view of YODA data is read-only")
+        if (flags & PyBUF_STRIDES) != PyBUF_STRIDES and self._strides[0] != sizeof(double):
+            raise BufferError("This view of YODA data is not contiguous")
+        buf.buf = self._data
+        buf.obj = self
+        buf.len = self._shape[0] * sizeof(double)
+        buf.readonly = self._readonly
+        buf.itemsize = sizeof(double)
+        buf.format = NULL
+        if flags & PyBUF_FORMAT:
+            buf.format = b"d"
+        buf.ndim = 1
+        buf.shape = NULL
+        if flags & PyBUF_ND:
+            buf.shape = self._shape
+        buf.strides = NULL
+        if (flags & PyBUF_STRIDES) == PyBUF_STRIDES:
+            buf.strides = self._strides
+        buf.suboffsets = NULL
+        buf.internal = NULL
+
+    def __releasebuffer__(self, Py_buffer* buf):
+        pass
+
+    def __len__(self):
+        return self._shape[0]
+
+
+cdef object _asarray(ArrayView v):
+    "Wrap the view as a numpy array, or a memoryview if numpy isn't available"
+    try:
+        import numpy
+        return numpy.asarray(v)
+    except ImportError:
+        return memoryview(v)
+
+cdef object _mkview(object owner, char* data, size_t n, Py_ssize_t stride, bint writable):
+    "Zero-copy view of n doubles starting at data, stride bytes apart, inside owner"
+    cdef ArrayView v = ArrayView.__new__(ArrayView)
+    v._owner = owner
+    v._data = data if n > 0 else <char*> &v._empty
+    v._shape[0] = n
+    v._strides[0] = stride if n > 1 else sizeof(double)
+    v._readonly = not writable
+    return _asarray(v)
+
+cdef object _mkarray(vector[double]& vals):
+    "Take over the contents of vals as a numpy array, or a list if numpy isn't available"
+    cdef ArrayView v = ArrayView.__new__(ArrayView)
+    v._store.swap(vals)
+    v._data = <char*> v._store.data() if not v._store.empty() else <char*> &v._empty
+    v._shape[0] = v._store.size()
+    v._strides[0] = sizeof(double)
+    v._readonly = False
+    try:
+        import numpy
+        return numpy.asarray(v)
+    except ImportError:
+        return list(memoryview(v))
+
+
+import array as _pyarray
+
+cdef const double[::1] _asdoubles(object xs, size_t n=<size_t>-1, name="values"):
+    """Contiguous float64 view of xs, converting first if it isn't such a buffer.
+    If n is given, the length must match it."""
+    cdef const double[::1] rtn
+    try:
+        rtn = xs
+    except (TypeError, ValueError):
+        rtn = _pyarray.array('d', xs)
+    if n != <size_t>-1 and <size_t> rtn.shape[0] != n:
+        raise ValueError("Array of %s has length %d rather than %d" % (name, rtn.shape[0], n))
+    return rtn
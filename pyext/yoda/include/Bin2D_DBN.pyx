@@ -141,7 +141,7 @@ cdef class Bin2D_${DBN}(Bin):
 
     #@property
     def yMean(self):
-        return self.b2ptr().xMean()
+        return self.b2ptr().yMean()
 
     #@property
     def xyMean(self):
@@ -154,7 +154,7 @@ cdef class Bin2D_${DBN}(Bin):
 
     #@property
     def yVariance(self):
-        return self.b2ptr().xVariance()
+        return self.b2ptr().yVariance()
 
     #@property
     def xyVariance(self):
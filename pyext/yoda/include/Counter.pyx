@@ -44,6 +44,20 @@ cdef class Counter(AnalysisObject):
         Fill with given optional weight."""
         self.cptr().fill(weight, fraction)
 
+    def fillArray(self, weights, double fraction=1.0):
+        """(ws) -> None.
+        Fill once with each of the weights in the array ws.
+
+        Any contiguous float64 buffer, such as a numpy array, is used directly,
+        and other sequences are converted first. The filling loop runs without
+        the GIL, so other Python threads can fill other objects meanwhile."""
+        cdef const double[::1] cws = _asdoubles(weights)
+        cdef c.Counter* cn = self.cptr()
+        cdef size_t i
+        with nogil:
+            for i in range(<size_t> cws.shape[0]):
+                cn.fill(cws[i], fraction)
+
 
     #@property
     def numEntries(self):
@@ -96,6 +96,22 @@ cdef class Histo1D(AnalysisObject):
         Fill with given x value and optional weight."""
         self.h1ptr().fill(x, weight, fraction)
 
+    def fillArray(self, xs, weights=None, double fraction=1.0):
+        """(xs,[ws]) -> None.
+        Fill with each of the x values in the array xs, and optional weights ws.
+
+        Any contiguous float64 buffer, such as a numpy array, is used directly,
+        and other sequences are converted first. The filling loop runs without
+        the GIL, so other Python threads can fill other objects meanwhile."""
+        cdef const double[::1] cxs = _asdoubles(xs)
+        cdef size_t i, n = cxs.shape[0]
+        cdef const double[::1] cws = _asdoubles(weights, n, "weights") if weights is not None else None
+        cdef bint weighted = weights is not None
+        cdef c.Histo1D* h = self.h1ptr()
+        with nogil:
+            for i in range(n):
+                h.fill(cxs[i], cws[i] if weighted else 1.0, fraction)
+
 
     def fillBin(self, size_t ix, weight=1.0, fraction=1.0):
         """(ix,[w]) -> None.
@@ -135,7 +151,7 @@ cdef class Histo1D(AnalysisObject):
     def integralTo(self, int ia, includeunderflow=True):
         """(int, [bool]) -> float
         Integral up to bin ia inclusive, optionally excluding the underflow"""
-        return self.h1ptr().integralRange(ia, includeunderflow)
+        return self.h1ptr().integralTo(ia, includeunderflow)
 
 
     def numEntries(self, includeoverflows=True):
@@ -404,9 +420,40 @@ cdef class Histo1D(AnalysisObject):
 
     ## Functions for array-based plotting, chi2 calculations, etc.
 
-    # def sumWs(self):
-    #     """All sumWs of the histo."""
-    #     return [b.sumW for b in self.bins]
+    cdef object _binSums(self, size_t k, bint writable):
+        "View of the k'th running sum of every bin, in Dbn sumsPtr() order"
+        cdef vector[c.HistoBin1D]* bins = &self.h1ptr().bins()
+        if bins.empty():
+            return _mkview(self, NULL, 0, 0, writable)
+        cdef char* data = <char*> (deref(bins)[0].dbn().sumsPtr() + k)
+        return _mkview(self, data, bins.size(), sizeof(c.HistoBin1D), writable)
+
+    def sumWs(self, writable=False):
+        """(bool) -> array
+
+        All sumWs of the histo, as a view of the bin storage rather than a copy.
+        With writable=True, changes made through the view (e.g. bulk scaling)
+        go straight into the bins; the total and overflow distributions are not
+        updated. Any change to the binning invalidates the view."""
+        return self._binSums(1, writable)
+
+    def sumW2s(self, writable=False):
+        """(bool) -> array
+
+        All sums of squared weights of the histo, as a view: see sumWs."""
+        return self._binSums(2, writable)
+
+    def sumWXs(self, writable=False):
+        """(bool) -> array
+
+        All sums of weight*x of the histo, as a view: see sumWs."""
+        return self._binSums(3, writable)
+
+    def sumWX2s(self, writable=False):
+        """(bool) -> array
+
+        All sums of weight*x^2 of the histo, as a view: see sumWs."""
+        return self._binSums(4, writable)
 
     def _mknp(self, xs):
         try:
@@ -418,7 +465,8 @@ cdef class Histo1D(AnalysisObject):
     #@property
     def xEdges(self):
         """All x edges of the histo."""
-        return self._mknp(self.h1ptr().xEdges())
+        cdef vector[double] edges = self.h1ptr().xEdges()
+        return _mkarray(edges)
 
     def xMins(self):
         """All x low edges of the histo."""
@@ -80,6 +80,23 @@ cdef class Histo2D(AnalysisObject):
         Fill with given x,y values and optional weight."""
         self.h2ptr().fill(x, y, weight, fraction)
 
+    def fillArray(self, xs, ys, weights=None, double fraction=1.0):
+        """(xs,ys,[ws]) -> None.
+        Fill with each of the x,y value pairs in the arrays xs and ys, and optional weights ws.
+
+        Any contiguous float64 buffer, such as a numpy array, is used directly,
+        and other sequences are converted first. The filling loop runs without
+        the GIL, so other Python threads can fill other objects meanwhile."""
+        cdef const double[::1] cxs = _asdoubles(xs)
+        cdef size_t i, n = cxs.shape[0]
+        cdef const double[::1] cys = _asdoubles(ys, n, "y values")
+        cdef const double[::1] cws = _asdoubles(weights, n, "weights") if weights is not None else None
+        cdef bint weighted = weights is not None
+        cdef c.Histo2D* h = self.h2ptr()
+        with nogil:
+            for i in range(n):
+                h.fill(cxs[i], cys[i], cws[i] if weighted else 1.0, fraction)
+
     def fillBin(self, size_t i, weight=1.0, fraction=1.0):
         """(i,[w]) -> None.
         Fill bin i and optional weight."""
@@ -356,9 +373,32 @@ cdef class Histo2D(AnalysisObject):
 
     ## Functions for array-based plotting, chi2 calculations, etc.
 
-    # def sumWs(self):
-    #     """All sumWs of the histo."""
-    #     return [b.sumW for b in self.bins()]
+    cdef object _binSums(self, size_t k, bint writable):
+        "View of the k'th running sum of every bin, in Dbn sumsPtr() order"
+        # Entry counts and weight sums are repeated in each axis block of the
+        # Dbn2D, so writing just one of the copies would corrupt the means
+        if writable and k < 10 and k % 5 < 3:
+            raise ValueError("Sums of weights can't be written through a view: each bin keeps one copy per axis")
+        cdef vector[c.HistoBin2D]* bins = &self.h2ptr().bins()
+        if bins.empty():
+            return _mkview(self, NULL, 0, 0, writable)
+        cdef char* data = <char*> (deref(bins)[0].dbn().sumsPtr() + k)
+        return _mkview(self, data, bins.size(), sizeof(c.HistoBin2D), writable)
+
+    def sumWs(self, writable=False):
+        """(bool) -> array
+
+        All sumWs of the histo, as a view of the bin storage rather than a copy.
+        Any change to the binning invalidates the view. The bins hold a copy of
+        their weight sums per axis, so writable=True is refused: use scaleW()
+        to rescale them."""
+        return self._binSums(1, writable)
+
+    def sumW2s(self, writable=False):
+        """(bool) -> array
+
+        All sums of squared weights of the histo, as a view: see sumWs."""
+        return self._binSums(2, writable)
 
     def _mknp(self, xs):
         try:
@@ -369,7 +409,8 @@ cdef class Histo2D(AnalysisObject):
 
     def xEdges(self):
         """All x edges of the histo."""
-        return self._mknp(self.h2ptr().xEdges())
+        cdef vector[double] edges = self.h2ptr().xEdges()
+        return _mkarray(edges)
 
     def xMins(self):
         """All x low edges of the histo."""
@@ -410,7 +451,8 @@ cdef class Histo2D(AnalysisObject):
 
     def yEdges(self):
         """All y edges of the histo."""
-        return self._mknp(self.h2ptr().yEdges())
+        cdef vector[double] edges = self.h2ptr().yEdges()
+        return _mkarray(edges)
 
     def yMins(self):
         """All y low edges of the histo."""
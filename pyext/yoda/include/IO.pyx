@@ -54,6 +54,88 @@ cdef dict _aobjects_to_dict(vector[c.AnalysisObject*]* aobjects, patterns, unpat
             out[newao.path()] = newao
     return out
 
+## Parse one BEGIN..END block of YODA-format text into a single Python analysis object
+cdef object _aobject_from_yoda_block(bytes block):
+    cdef c.istringstream iss
+    cdef vector[c.AnalysisObject*] aobjects
+    iss.str(<string> block)
+    c.ReaderYODA_create().read(iss, aobjects)
+    aos = _aobjects_to_list(&aobjects, None, None)
+    if len(aos) != 1:
+        raise ValueError("Expected one analysis object in YODA block, found %d" % len(aos))
+    return aos[0]
+
+
+from collections.abc import Mapping as _Mapping
+
+class LazyAOMap(_Mapping):
+    """
+    Read-only mapping of paths to the analysis objects in a YODA-format file,
+    which are only parsed when first looked up.
+
+    The keys come from a scan of the file's BEGIN lines, so listing, counting
+    and membership tests are cheap. Plain files are memory-mapped rather than
+    read in; compressed ones are decompressed in memory.
+    """
+
+    _BEGIN_RE = None
+
+    def __init__(self, filename, patterns=None, unpatterns=None):
+        import mmap, re
+        if LazyAOMap._BEGIN_RE is None:
+            LazyAOMap._BEGIN_RE = re.compile(br"^[ \t#]*BEGIN[ \t]+YODA_\w+(?:[ \t]+(\S+))?", re.M)
+        with open(filename, "rb") as f:
+            if f.read(2) == b"\x1f\x8b":
+                import gzip
+                f.seek(0)
+                self._data = gzip.GzipFile(fileobj=f).read()
+            else:
+                f.seek(0)
+                try:
+                    self._data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+                except ValueError: #< empty file
+                    self._data = b""
+        ## Each block runs up to the next BEGIN: the parser skips the blank and comment lines in between
+        starts, paths = [], []
+        for m in LazyAOMap._BEGIN_RE.finditer(self._data):
+            starts.append(m.start())
+            paths.append((m.group(1) or b"").decode("utf-8"))
+        starts.append(len(self._data))
+        self._blocks = {}
+        for i, path in enumerate(paths):
+            if _pattern_check(path, patterns, unpatterns):
+                self._blocks[path] = (starts[i], starts[i+1])
+        self._aos = {}
+
+    def __getitem__(self, path):
+        ao = self._aos.get(path)
+        if ao is None:
+            begin, end = self._blocks[path]
+            ao = _aobject_from_yoda_block(bytes(self._data[begin:end]))
+            self._aos[path] = ao
+        return ao
+
+    def __iter__(self):
+        return iter(self._blocks)
+
+    def __len__(self):
+        return len(self._blocks)
+
+    def __contains__(self, path):
+        return path in self._blocks
+
+    def __repr__(self):
+        return "<%s with %d objects, %d loaded>" % (self.__class__.__name__, len(self._blocks), len(self._aos))
+
+
+## Whether a filename is (possibly compressed) YODA format, as in mkReader
+def _is_yoda_filename(filename):
+    name = filename.lower()
+    if name.endswith(".gz"):
+        name = name[:-3]
+    return "." in name and name.rsplit(".", 1)[1].startswith("yoda")
+
+
 # ## Set a istringstream's string from a C/Python string
 # cdef void _make_iss(c.istringstream &iss, string s):
 #     iss.str(s)
@@ -87,7 +169,7 @@ def _str_to_file(s, file_or_filename):
 ## Readers
 ##
 
-def read(filename, asdict=True, patterns=None, unpatterns=None):
+def read(filename, asdict=True, patterns=None, unpatterns=None, lazy=False):
     """
     Read data objects from the provided filename, auto-determining the format
     from the file extension.
@@ -99,7 +181,11 @@ def read(filename, asdict=True, patterns=None, unpatterns=None):
     match any unpatterns, will be returned.
 
     Returns a dict or list of analysis objects depending on the asdict argument.
+    With asdict and lazy both true, a YODA-format file is instead returned as a
+    LazyAOMap, which only parses each object when it is first accessed.
     """
+    if asdict and lazy and _is_yoda_filename(filename):
+        return LazyAOMap(filename, patterns, unpatterns)
     # cdef c.istringstream iss
     # cdef vector[c.AnalysisObject*] aobjects
     # with open(filename, "r") as f:
@@ -115,7 +201,7 @@ def read(filename, asdict=True, patterns=None, unpatterns=None):
         else _aobjects_to_list(&aobjects, patterns, unpatterns)
 
 
-def readYODA(filename, asdict=True, patterns=None, unpatterns=None):
+def readYODA(filename, asdict=True, patterns=None, unpatterns=None, lazy=False):
     """
     Read data objects from the provided YODA-format file.
 
@@ -126,7 +212,11 @@ def readYODA(filename, asdict=True, patterns=None, unpatterns=None):
     match any unpatterns, will be returned.
 
     Returns a dict or list of analysis objects depending on the asdict argument.
+    With asdict and lazy both true, a LazyAOMap is returned instead of a dict,
+    which only parses each object when it is first accessed.
     """
+    if asdict and lazy:
+        return LazyAOMap(filename, patterns, unpatterns)
     # cdef c.istringstream iss
     cdef vector[c.AnalysisObject*] aobjects
     # s = _str_from_file(file_or_filename)
@@ -137,6 +227,34 @@ def readYODA(filename, asdict=True, patterns=None, unpatterns=None):
         else _aobjects_to_list(&aobjects, patterns, unpatterns)
 
 
+from collections import namedtuple as _namedtuple
+
+ScanRecord = _namedtuple("ScanRecord", ["path", "type", "begin", "end", "numLines", "numDataLines", "numBins", "total"])
+ScanRecord.__doc__ = """\
+Summary of one object in a YODA-format file, from scan(): its path and type
+name, the [begin, end) byte range of its block in the (decompressed) file,
+the numbers of lines in the block and of data rows, the number of bins or
+points, and the raw text of its total row (or None if not requested)."""
+
+def scan(filename, totals=False):
+    """
+    Summarise the analysis objects in a YODA-format file, without reading them.
+
+    Only the BEGIN, END and annotation lines are interpreted, so this is much
+    faster than read() for finding what a large file contains. Returns a list
+    of ScanRecords in file order. If totals is true, each record's total field
+    holds the text of the object's "Total" row, or the data row of a Counter,
+    from which e.g. the sum of weights can be taken without a full parse.
+    """
+    cdef vector[c.ReaderYODA_ScanRecord] recs = c.ReaderYODA_scan(filename.encode('utf-8'), totals)
+    out = []
+    for r in recs:
+        total = r.total.decode('utf-8') if totals else None
+        out.append(ScanRecord(r.path.decode('utf-8'), r.type.decode('utf-8'), r.begin, r.end,
+                              r.numLines, r.numDataLines, r.numBins, total))
+    return out
+
+
 def readFLAT(filename, asdict=True, patterns=None, unpatterns=None):
     """
     Read data objects from the provided FLAT-format file.
@@ -183,23 +301,69 @@ def readAIDA(filename, asdict=True, patterns=None, unpatterns=None):
         else _aobjects_to_list(&aobjects, patterns, unpatterns)
 
 
+def readLive(name, asdict=True, patterns=None, unpatterns=None):
+    """
+    Read a snapshot of the data objects published to the named POSIX
+    shared-memory segment by a running job's YODA::LiveExport.
+
+    Each object is a consistent copy of its state at one of the job's updates,
+    taken without pausing the job. The patterns and unpatterns arguments filter
+    the objects by path, as in read().
+
+    Returns a dict or list of analysis objects depending on the asdict argument.
+    """
+    cdef vector[c.AnalysisObject*] aobjects = c.readLive(name.encode('utf-8'))
+    return _aobjects_to_dict(&aobjects, patterns, unpatterns) if asdict \
+        else _aobjects_to_list(&aobjects, patterns, unpatterns)
+
+
+def fillFromText(AnalysisObject ao, filename="-", nthreads=1):
+    """
+    Fill a histogram or profile from rows of numbers in a text file, or stdin
+    if the filename is "-".
+
+    Each row holds the fill coordinates (x; x and y; or x, y and z) followed by
+    an optional weight, separated by whitespace or commas. The parsing and
+    filling are done in C++ without the GIL, by nthreads threads (0 for one per
+    core), so this is much faster than calling fill() for each row. Returns the
+    number of rows filled.
+    """
+    cdef c.AnalysisObject* cao = ao.aoptr()
+    cdef string cfilename = filename.encode('utf-8')
+    cdef size_t cnthreads = nthreads
+    cdef size_t nrows
+    with nogil:
+        nrows = c.fillFromText(deref(cao), cfilename, cnthreads)
+    return nrows
+
+
 ##
 ## Writers
 ##
 
-def write(ana_objs, filename):
+def write(ana_objs, filename, nthreads=1):
     """
     Write data objects to the provided filename,
     auto-determining the format from the file extension.
+
+    If nthreads > 1, the objects are formatted, and compressed if writing to a
+    .gz file, on that many threads: this speeds up writing many objects.
     """
     # cdef c.ostringstream oss
     cdef vector[c.AnalysisObject*] vec
     cdef AnalysisObject a
+    cdef c.WriterOptions opts
+    cdef unique_ptr[c.Writer] w
     aolist = ana_objs.values() if hasattr(ana_objs, "values") else ana_objs \
              if hasattr(ana_objs, "__iter__") else [ana_objs]
     for a in aolist:
         vec.push_back(a._AnalysisObject())
-    c.IO_write_to_file(filename.encode('utf-8'), vec)
+    if nthreads == 1:
+        c.IO_write_to_file(filename.encode('utf-8'), vec)
+    else:
+        opts.nthreads = nthreads
+        w = c.Writer_make(filename.encode('utf-8'), opts)
+        w.get().write_to_file(filename.encode('utf-8'), vec)
     #_str_to_file(oss.str(), filename)
 
 
@@ -255,3 +419,44 @@ def writeAIDA(ana_objs, file_or_filename):
     else:
         c.WriterAIDA_create().write(oss, vec)
         _str_to_file(oss.str(), file_or_filename)
+
+
+##
+## Batch conversion
+##
+
+ConvertStats = _namedtuple("ConvertStats", ["infile", "outfile", "numObjects", "inBytes", "outBytes", "seconds", "error"])
+ConvertStats.__doc__ = """\
+Outcome of one file's conversion by convert(): the file names, the number of
+objects written, the input and output file sizes in bytes, the wall-clock time
+taken, and the error message if the conversion failed (otherwise None)."""
+
+def convert(in_out, informat=None, outformat=None, match=None, unmatch=None, asScatters=False, nthreads=0):
+    """
+    Convert each of the (infile, outfile) pairs in in_out, in parallel.
+
+    The formats are identified from the filenames unless given as e.g. "yoda",
+    "flat" or "aida" by the informat and outformat arguments. The match and
+    unmatch regexes (strings or compiled) filter the objects by path, and if
+    asScatters is true, every object is written as its scatter representation.
+
+    The files are read, converted and written in C++ without the GIL, by
+    nthreads threads (0 for one per core), each holding only one file's objects
+    at a time. Returns a list of ConvertStats in the order of in_out: a failed
+    conversion is reported by its error field rather than raised.
+    """
+    cdef vector[pair[string,string]] cinout
+    for i, o in in_out:
+        cinout.push_back(pair[string,string](i.encode('utf-8'), o.encode('utf-8')))
+    cdef c.ConvertOptions opts
+    opts.inFormat = (informat or "").encode('utf-8')
+    opts.outFormat = (outformat or "").encode('utf-8')
+    opts.match = getattr(match, "pattern", match or "").encode('utf-8')
+    opts.unmatch = getattr(unmatch, "pattern", unmatch or "").encode('utf-8')
+    opts.asScatters = asScatters
+    opts.nthreads = nthreads
+    cdef vector[c.ConvertStats] cstats
+    with nogil:
+        cstats = c.convert(cinout, opts)
+    return [ConvertStats(s.infile.decode('utf-8'), s.outfile.decode('utf-8'), s.numObjects, s.inBytes, s.outBytes,
+                         s.seconds, s.error.decode('utf-8') if s.error.size() else None) for s in cstats]
@@ -0,0 +1,100 @@
+cimport util
+
+cdef class Histo1DIntegrals(util.Base):
+    """
+    Snapshot of a Histo1D's cumulative bin sums, answering integral queries
+    in constant time. Later changes to the histogram are not seen: make a
+    new snapshot to include them.
+
+    Histo1DIntegrals(h).
+      Take the cumulative sums of histogram h.
+    """
+
+    cdef inline c.Histo1DIntegrals* i1ptr(self) except NULL:
+        return <c.Histo1DIntegrals*> self.ptr()
+
+    def __dealloc__(self):
+        cdef c.Histo1DIntegrals* p = <c.Histo1DIntegrals*> self._ptr
+        if self._deallocate:
+            del p
+
+
+    def __init__(self, Histo1D h):
+        cutil.set_owned_ptr(self, new c.Histo1DIntegrals(deref(h.h1ptr())))
+
+    def __repr__(self):
+        return "<%s with %d bins>" % (self.__class__.__name__, self.numBins())
+
+
+    def numBins(self):
+        """() -> int
+        Number of bins."""
+        return self.i1ptr().numBins()
+
+    def integral(self):
+        """() -> float
+        Integral of all the bins, without the overflows."""
+        return self.i1ptr().integral()
+
+    def integralRange(self, size_t ia, size_t ib):
+        """(int, int) -> float
+        Integral between bins ia..ib inclusive"""
+        return self.i1ptr().integralRange(ia, ib)
+
+    def integralTo(self, size_t ia, includeunderflow=True):
+        """(int, [bool]) -> float
+        Integral up to bin ia inclusive, optionally excluding the underflow"""
+        return self.i1ptr().integralTo(ia, includeunderflow)
+
+
+cdef class Histo2DIntegrals(util.Base):
+    """
+    Snapshot of a Histo2D's summed-area table, answering integral queries
+    in constant time. Integrals are over the cells of the grid of bin
+    edges, which are the bins themselves for a regular binning; a bin
+    spanning several cells is counted in its lowest one.
+
+    Histo2DIntegrals(h).
+      Build the summed-area table of histogram h.
+    """
+
+    cdef inline c.Histo2DIntegrals* i2ptr(self) except NULL:
+        return <c.Histo2DIntegrals*> self.ptr()
+
+    def __dealloc__(self):
+        cdef c.Histo2DIntegrals* p = <c.Histo2DIntegrals*> self._ptr
+        if self._deallocate:
+            del p
+
+
+    def __init__(self, Histo2D h):
+        cutil.set_owned_ptr(self, new c.Histo2DIntegrals(deref(h.h2ptr())))
+
+    def __repr__(self):
+        return "<%s with %dx%d cells>" % (self.__class__.__name__, self.numCellsX(), self.numCellsY())
+
+
+    def numCellsX(self):
+        """() -> int
+        Number of cells along x."""
+        return self.i2ptr().numCellsX()
+
+    def numCellsY(self):
+        """() -> int
+        Number of cells along y."""
+        return self.i2ptr().numCellsY()
+
+    def integral(self):
+        """() -> float
+        Integral of all the bins, without the overflows."""
+        return self.i2ptr().integral()
+
+    def integralRange(self, size_t ixa, size_t ixb, size_t iya, size_t iyb):
+        """(int, int, int, int) -> float
+        Integral over the x cells ixa..ixb and y cells iya..iyb inclusive"""
+        return self.i2ptr().integralRange(ixa, ixb, iya, iyb)
+
+    def integralTo(self, size_t ix, size_t iy):
+        """(int, int) -> float
+        Integral up to x cell ix and y cell iy inclusive"""
+        return self.i2ptr().integralTo(ix, iy)
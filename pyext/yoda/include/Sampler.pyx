@@ -0,0 +1,131 @@
+cimport util
+from libc.stdint cimport uint64_t
+
+cdef class Histo1DSampler(util.Base):
+    """
+    Random x values distributed as a Histo1D, e.g. for drawing toy events.
+
+    A bin is picked with probability proportional to its sum of weights, in
+    constant time whatever the number of bins, and the value is placed
+    uniformly within it. Under- and overflows are not sampled. The sampler
+    copies what it needs, so later changes to the histogram don't affect it.
+
+    Histo1DSampler(h, seed=5489).
+      Construct a sampler of histogram h, with the given random seed.
+    """
+
+    cdef inline c.Histo1DSampler* s1ptr(self) except NULL:
+        return <c.Histo1DSampler*> self.ptr()
+
+    def __dealloc__(self):
+        cdef c.Histo1DSampler* p = <c.Histo1DSampler*> self._ptr
+        if self._deallocate:
+            del p
+
+
+    def __init__(self, Histo1D h, uint64_t seed=5489):
+        cutil.set_owned_ptr(self, new c.Histo1DSampler(deref(h.h1ptr()), seed))
+
+    def __repr__(self):
+        return "<%s with %d bins>" % (self.__class__.__name__, self.numBins())
+
+
+    def seed(self, uint64_t seed):
+        """(int) -> None
+        Restart the random sequence from the given seed."""
+        self.s1ptr().seed(seed)
+
+    def numBins(self):
+        """() -> int
+        Number of bins sampled from."""
+        return self.s1ptr().numBins()
+
+
+    def sample(self, n=None):
+        """([n]) -> float or array
+        Draw one value, or an array of n values: a numpy array if numpy is
+        available. The drawing runs without the GIL."""
+        if n is None:
+            return self.s1ptr().sample()
+        cdef vector[double] xs = vector[double](<size_t> n)
+        cdef c.Histo1DSampler* s = self.s1ptr()
+        with nogil:
+            s.sample(xs.data(), xs.size())
+        return _mkarray(xs)
+
+    def sampleInto(self, xs):
+        """(array) -> None
+        Fill the writable float64 buffer xs, such as a numpy array, with drawn values."""
+        cdef double[::1] cxs = xs
+        cdef c.Histo1DSampler* s = self.s1ptr()
+        if cxs.shape[0] == 0:
+            return
+        with nogil:
+            s.sample(&cxs[0], cxs.shape[0])
+
+
+cdef class Histo2DSampler(util.Base):
+    """
+    Random (x,y) points distributed as a Histo2D, e.g. for drawing toy events.
+
+    As for Histo1DSampler, with the points placed uniformly in the chosen bin.
+
+    Histo2DSampler(h, seed=5489).
+      Construct a sampler of histogram h, with the given random seed.
+    """
+
+    cdef inline c.Histo2DSampler* s2ptr(self) except NULL:
+        return <c.Histo2DSampler*> self.ptr()
+
+    def __dealloc__(self):
+        cdef c.Histo2DSampler* p = <c.Histo2DSampler*> self._ptr
+        if self._deallocate:
+            del p
+
+
+    def __init__(self, Histo2D h, uint64_t seed=5489):
+        cutil.set_owned_ptr(self, new c.Histo2DSampler(deref(h.h2ptr()), seed))
+
+    def __repr__(self):
+        return "<%s with %d bins>" % (self.__class__.__name__, self.numBins())
+
+
+    def seed(self, uint64_t seed):
+        """(int) -> None
+        Restart the random sequence from the given seed."""
+        self.s2ptr().seed(seed)
+
+    def numBins(self):
+        """() -> int
+        Number of bins sampled from."""
+        return self.s2ptr().numBins()
+
+
+    def sample(self, n=None):
+        """([n]) -> (float, float) or (array, array)
+        Draw one point, or arrays of the x and y values of n points: numpy
+        arrays if numpy is available. The drawing runs without the GIL."""
+        cdef pair[double, double] xy
+        if n is None:
+            xy = self.s2ptr().sample()
+            return (xy.first, xy.second)
+        cdef vector[double] xs = vector[double](<size_t> n)
+        cdef vector[double] ys = vector[double](<size_t> n)
+        cdef c.Histo2DSampler* s = self.s2ptr()
+        with nogil:
+            s.sample(xs.data(), ys.data(), xs.size())
+        return _mkarray(xs), _mkarray(ys)
+
+    def sampleInto(self, xs, ys):
+        """(array, array) -> None
+        Fill the writable float64 buffers xs and ys, of equal length, with the
+        x and y values of drawn points."""
+        cdef double[::1] cxs = xs
+        cdef double[::1] cys = ys
+        cdef c.Histo2DSampler* s = self.s2ptr()
+        if cys.shape[0] != cxs.shape[0]:
+            raise ValueError("Array of y values has length %d rather than %d" % (cys.shape[0], cxs.shape[0]))
+        if cxs.shape[0] == 0:
+            return
+        with nogil:
+            s.sample(&cxs[0], &cys[0], cxs.shape[0])
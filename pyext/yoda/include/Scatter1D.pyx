@@ -150,8 +150,30 @@ cdef class Scatter1D(AnalysisObject):
         except ImportError:
             return xs
 
-    def xVals(self):
-        return self._mknp([p.x() for p in self.points()])
+    cdef object _vals(self, size_t i, bint view, bint writable):
+        "Point values along axis i, copied or as a view of the point storage"
+        cdef vector[c.Point1D]* pts = <vector[c.Point1D]*> &self.s1ptr().points()
+        cdef size_t n = pts.size()
+        cdef vector[double] vals
+        cdef size_t k
+        if not (view or writable):
+            vals.resize(n)
+            for k in range(n):
+                vals[k] = deref(deref(pts)[k].valPtr(i))
+            return _mkarray(vals)
+        if writable:
+            raise ValueError("The x values can't be written through a view: the points are sorted on them")
+        if n == 0:
+            return _mkview(self, NULL, 0, 0, writable)
+        return _mkview(self, <char*> deref(pts)[0].valPtr(i), n, sizeof(c.Point1D), writable)
+
+    def xVals(self, view=False, writable=False):
+        """(bool, bool) -> array
+
+        The x values of all the points. By default this is a copy: with view=True
+        it is instead a view of the point storage, invalidated by adding or
+        removing points."""
+        return self._vals(1, view, writable)
 
     def xMins(self):
         """All x low values."""
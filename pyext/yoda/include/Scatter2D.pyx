@@ -179,6 +179,22 @@ cdef class Scatter2D(AnalysisObject):
         Construct the covariance matrix"""
         return self._mknp(self.s2ptr().covarianceMatrix(ignoreOffDiagonalTerms))
 
+    def covarianceSplit(self, ignoreOffDiagonalTerms=False, nthreads=0):
+        """(bool, int) -> (total, correlated, uncorrelated)
+        Construct the covariance matrix and its bin-to-bin correlated and
+        uncorrelated parts. The correlated part is built with nthreads threads
+        (0 = choose automatically)."""
+        cdef c.CovarianceSplit cs = self.s2ptr().covariance(ignoreOffDiagonalTerms, nthreads)
+        n = cs.total.size()
+        return tuple(self._mksquare(m, n) for m in (cs.total.data(), cs.correlated.data(), cs.uncorrelated.data()))
+
+    def _mksquare(self, vals, n):
+        try:
+            import numpy
+            return numpy.array(vals).reshape((n, n))
+        except ImportError:
+            return [vals[i*n:(i+1)*n] for i in range(n)]
+
     # # TODO: remove?
     # def __add__(Scatter2D self, Scatter2D other):
     #     return cutil.new_owned_cls(Scatter2D, c.Scatter2D_add_Scatter2D(self.s2ptr(), other.s2ptr()))
@@ -222,8 +238,30 @@ cdef class Scatter2D(AnalysisObject):
         return self._mknp(corr)
 
 
-    def xVals(self):
-        return self._mknp([p.x() for p in self.points()])
+    cdef object _vals(self, size_t i, bint view, bint writable):
+        "Point values along axis i, copied or as a view of the point storage"
+        cdef vector[c.Point2D]* pts = <vector[c.Point2D]*> &self.s2ptr().points()
+        cdef size_t n = pts.size()
+        cdef vector[double] vals
+        cdef size_t k
+        if not (view or writable):
+            vals.resize(n)
+            for k in range(n):
+                vals[k] = deref(deref(pts)[k].valPtr(i))
+            return _mkarray(vals)
+        if writable and i < 2:
+            raise ValueError("Only the y values can be written through a view: the points are sorted on the others")
+        if n == 0:
+            return _mkview(self, NULL, 0, 0, writable)
+        return _mkview(self, <char*> deref(pts)[0].valPtr(i), n, sizeof(c.Point2D), writable)
+
+    def xVals(self, view=False, writable=False):
+        """(bool, bool) -> array
+
+        The x values of all the points. By default this is a copy: with view=True
+        it is instead a view of the point storage, invalidated by adding or
+        removing points, and writable=True allows bulk changes to the y values through it."""
+        return self._vals(1, view, writable)
 
     def xMins(self):
         """All x low values."""
@@ -256,8 +294,11 @@ cdef class Scatter2D(AnalysisObject):
         return max(self.xMaxs())
 
 
-    def yVals(self):
-        return self._mknp([p.y() for p in self.points()])
+    def yVals(self, view=False, writable=False):
+        """(bool, bool) -> array
+
+        The y values of all the points, as a copy or a view: see xVals."""
+        return self._vals(2, view, writable)
 
     def yMins(self):
         """All y low values."""
@@ -193,8 +193,30 @@ cdef class Scatter3D(AnalysisObject):
         except ImportError:
             return xs
 
-    def xVals(self):
-        return self._mknp([p.x() for p in self.points()])
+    cdef object _vals(self, size_t i, bint view, bint writable):
+        "Point values along axis i, copied or as a view of the point storage"
+        cdef vector[c.Point3D]* pts = <vector[c.Point3D]*> &self.s3ptr().points()
+        cdef size_t n = pts.size()
+        cdef vector[double] vals
+        cdef size_t k
+        if not (view or writable):
+            vals.resize(n)
+            for k in range(n):
+                vals[k] = deref(deref(pts)[k].valPtr(i))
+            return _mkarray(vals)
+        if writable and i < 3:
+            raise ValueError("Only the z values can be written through a view: the points are sorted on the others")
+        if n == 0:
+            return _mkview(self, NULL, 0, 0, writable)
+        return _mkview(self, <char*> deref(pts)[0].valPtr(i), n, sizeof(c.Point3D), writable)
+
+    def xVals(self, view=False, writable=False):
+        """(bool, bool) -> array
+
+        The x values of all the points. By default this is a copy: with view=True
+        it is instead a view of the point storage, invalidated by adding or
+        removing points, and writable=True allows bulk changes to the z values through it."""
+        return self._vals(1, view, writable)
 
     def xMins(self):
         """All x low values."""
@@ -215,8 +237,11 @@ cdef class Scatter3D(AnalysisObject):
         return max(self.xMaxs())
 
 
-    def yVals(self):
-        return self._mknp([p.y() for p in self.points()])
+    def yVals(self, view=False, writable=False):
+        """(bool, bool) -> array
+
+        The y values of all the points, as a copy or a view: see xVals."""
+        return self._vals(2, view, writable)
 
     def yMins(self):
         """All x low values."""
@@ -237,8 +262,11 @@ cdef class Scatter3D(AnalysisObject):
         return max(self.yMaxs())
 
 
-    def zVals(self):
-        return self._mknp([p.z() for p in self.points()])
+    def zVals(self, view=False, writable=False):
+        """(bool, bool) -> array
+
+        The z values of all the points, as a copy or a view: see xVals."""
+        return self._vals(3, view, writable)
 
     def zMins(self):
         """All z low values."""
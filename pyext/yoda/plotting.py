@@ -273,14 +273,15 @@ def plot(hs, outfile=None, ratio=True, show=False, axmain=None, axratio=None, **
     """
     Plot the given histograms on a single figure, returning (fig, (main_axis,
     ratio_axis)). Show to screen if the second arg is True, and saving to outfile
-    if it is otherwise non-null.
+    if it is otherwise non-null: outfile may also be a list of filenames, e.g. to
+    save the same plot in several formats.
     """
 
     ## Case-insensitize the plotkeys dict
     plotkeys = mk_lowcase_dict(plotkeys)
 
     ## Handle single histo args
-    if isinstance(hs, yoda.AnalysisObject):
+    if isinstance(hs, (yoda.AnalysisObject, PlotData)):
         hs = [hs,]
         ratio = False
 
@@ -291,7 +292,6 @@ def plot(hs, outfile=None, ratio=True, show=False, axmain=None, axratio=None, **
     # print xmin, xmax, xdiff
     # TODO: Tweak max-padding for top tick label... sensitive to log/lin measure
     ymin = plotkeys.get("ymin", min(min(h.yVals()) for h in hs))
-    print( max(max(h.yVals()) for h in hs) )
     ymax = plotkeys.get("ymax", 1.1*max(max(h.yVals()) for h in hs))
     ymin = float(ymin)
     ymax = float(ymax)
@@ -303,7 +303,7 @@ def plot(hs, outfile=None, ratio=True, show=False, axmain=None, axratio=None, **
     # TODO: Use ratio to setdefault RatioPlot in plotkeys, then use that to decide whether to look for href
     if ratio:
         for h in hs:
-            hkeys = mk_lowcase_dict(h.annotationsDict)
+            hkeys = mk_lowcase_dict(h.annotationsDict())
             if yoda.util.as_bool(hkeys.get("ratioref", False)):
                 if href is None:
                     href = h
@@ -378,7 +378,8 @@ def plot(hs, outfile=None, ratio=True, show=False, axmain=None, axratio=None, **
     ## Save to an image file if we were asked to
     if outfile:
         #print "Saving to " + outfile
-        fig.savefig(outfile)
+        for of in ([outfile] if isinstance(outfile, str) else outfile):
+            fig.savefig(of)
 
     ## Show to screen if requested
     if show:
@@ -394,12 +395,96 @@ plot_hists_1d = plot
 plot_hist_1d = plot
 
 
-def _plot1arg(args):
-    "Helper function for mplot, until Py >= 3.3 multiprocessing.pool.starmap() is available"
-    return plot(*args)
+class PlotData(object):
+    """
+    Lightweight, picklable snapshot of the data which the 1D plotting functions
+    read from a histogram, profile or scatter.
+
+    The YODA objects themselves wrap C++ pointers and can't be sent to other
+    processes, so nplot() converts them to these before handing them to its
+    worker processes. Each accessor returns exactly what the corresponding
+    method on the source object returned when the snapshot was taken, so a
+    plot of the snapshot is identical to a plot of the original.
+    """
+
+    def __init__(self, ao):
+        self._path = ao.path()
+        self._annotations = dict((k, ao.annotation(k)) for k in ao.annotations())
+        self._xmin, self._xmax = ao.xMin(), ao.xMax()
+        self._xmins, self._xmaxs = ao.xMins(), ao.xMaxs()
+        self._xvals, self._xerrs = ao.xVals(), ao.xErrs()
+        self._yvals, self._yerrs = ao.yVals(), ao.yErrs()
+        self._ymins, self._ymaxs = ao.yMins(), ao.yMaxs()
+
+    def path(self):
+        return self._path
+
+    def annotations(self):
+        return list(self._annotations.keys())
+
+    def annotation(self, k, default=None):
+        return self._annotations.get(k, default)
+
+    def annotationsDict(self):
+        return dict((k.lower(), v) for (k,v) in self._annotations.items())
+
+    def xMin(self):
+        return self._xmin
+
+    def xMax(self):
+        return self._xmax
+
+    def xMins(self):
+        return self._xmins
+
+    def xMaxs(self):
+        return self._xmaxs
+
+    def xVals(self):
+        return self._xvals
+
+    def xErrs(self):
+        return self._xerrs
+
+    def yVals(self):
+        return self._yvals
+
+    def yErrs(self):
+        return self._yerrs
+
+    def yMins(self):
+        return self._ymins
+
+    def yMaxs(self):
+        return self._ymaxs
 
 
-def nplot(hs, outfiles=None, ratio=True, show=False, nproc=1, **plotkeys):
+def mk_plotdata(hs):
+    """
+    Convert a single histogram or a list of histograms -- i.e. either kind of
+    valid first argument to plot() -- into PlotData snapshots.
+    """
+    if isinstance(hs, (yoda.AnalysisObject, PlotData)):
+        return hs if isinstance(hs, PlotData) else PlotData(hs)
+    return [h if isinstance(h, PlotData) else PlotData(h) for h in hs]
+
+
+def _init_plot_worker(rcparams):
+    "Pool initializer: configure matplotlib once per worker, as in the parent process"
+    changed = dict((k, v) for (k, v) in rcparams.items() if mpl.rcParams.get(k) != v)
+    mpl.rcParams.update(changed)
+
+
+def _plot_job(args):
+    "Render and save one plot, then close its figure and return the output filename(s)"
+    hs, outfile, ratio, plotkeys = args
+    fig, _ = plot(hs, outfile, ratio, False, **plotkeys)
+    import matplotlib.pyplot as plt
+    plt.close(fig)
+    return outfile
+
+
+def nplot(hs, outfiles=None, ratio=True, show=False, nproc=1, keys=None, close=False, progress=False, **plotkeys):
     """
     Plot the given list of histogram(s), cf. many calls to plot().
 
@@ -408,46 +493,83 @@ def nplot(hs, outfiles=None, ratio=True, show=False, nproc=1, **plotkeys):
     i.e. either kind of valid first argument to plot().
 
     Outfiles must be an iterable corresponding to hs, and ratio may either be a
-    bool or such an iterable.
+    bool or such an iterable. Each outfile may itself be a list of filenames, to
+    save the plot in several formats. The optional keys argument is another
+    such iterable, of dicts of per-plot keys which take precedence over the
+    plotkeys common to all plots. If progress is true, a status line is printed
+    as each plot is completed.
 
     The return value is a list of the return tuples from each call to plot(), of
-    the same length as the hs arg.
+    the same length as the hs arg. If close is true, each figure is instead
+    closed once it has been saved, and its output filename(s) returned in place
+    of the tuple: use this when making many plots, to bound the memory use.
 
 
-    MULTIPROCESSING -- *WARNING* CURRENTLY BROKEN
+    MULTIPROCESSING
 
     The main point of this function, other than convenience, is that the Python
     multiprocessing module can be used to distribute the work on to multiple
     parallel processes.
 
     The nproc argument should be the integer number of parallel processes on
-    which to distribute the plotting. nproc = None (the default value) will use
-    Ncpu-1 or 1 process, whichever is larger. If nproc = 1, multiprocessing will
-    not be used -- this avoids overhead and eases debugging.
+    which to distribute the plotting. nproc = None will use Ncpu-1 or 1 process,
+    whichever is larger. If nproc = 1 (the default), multiprocessing will not be
+    used -- this avoids overhead and eases debugging.
+
+    The histograms are sent to the workers as PlotData snapshots, and each
+    worker is set up once with the parent process' matplotlib configuration, so
+    the plots are identical to those made serially. The figures can't be
+    returned from the worker processes, so parallel mode always behaves as if
+    close were true, and show is then ignored.
     """
 
-    argslist = []
+    hs = list(hs)
+    jobs = []
     for i, hs_arg in enumerate(hs):
         outfile_arg = outfiles[i] if outfiles else None
         ratio_arg = ratio[i] if hasattr(ratio, "__iter__") else ratio
-        show_arg = False #< we just do this once, at the end
-        plotkeys_arg = plotkeys if type(plotkeys) is dict else plotkeys[i]
-        argslist.append( (hs_arg, outfile_arg, ratio_arg, show_arg, None, None, plotkeys_arg) )
-    #print argslist
+        plotkeys_arg = dict(plotkeys)
+        if keys:
+            plotkeys_arg.update(keys[i])
+        jobs.append( [hs_arg, outfile_arg, ratio_arg, plotkeys_arg] )
+
+    def _report(i, job):
+        if progress:
+            outstr = " ".join([job[1]] if isinstance(job[1], str) else job[1] or [])
+            print("Plotting to {o} ({i:d}/{n:d})".format(o=outstr, i=i+1, n=len(jobs)))
+            sys.stdout.flush()
 
-    # TODO: make the multiprocessing work
     import multiprocessing
-    nproc = nproc or multiprocessing.cpu_count() or 1
+    if nproc is None:
+        nproc = multiprocessing.cpu_count()-1 or 1
+    nproc = min(nproc, len(jobs))
+    rtn = []
     if nproc > 1:
-        pool = multiprocessing.Pool(processes=nproc)
-        res = pool.map_async(_plot1arg, argslist)
-        rtn = res.get()
+        for job in jobs:
+            job[0] = mk_plotdata(job[0])
+        chunksize = max(1, len(jobs) // (4*nproc))
+        pool = multiprocessing.Pool(processes=nproc, initializer=_init_plot_worker, initargs=(dict(mpl.rcParams),))
+        try:
+            for i, res in enumerate(pool.imap(_plot_job, jobs, chunksize)):
+                _report(i, jobs[i])
+                rtn.append(res)
+            pool.close()
+        except:
+            pool.terminate()
+            raise
+        finally:
+            pool.join()
     else:
         ## Run this way in the 1 proc case for easier debugging
-        rtn = [_plot1arg(args) for args in argslist]
-
-    if show:
-        import matplotlib.pyplot as plt
-        plt.show()
+        for i, job in enumerate(jobs):
+            if close:
+                rtn.append(_plot_job(job))
+            else:
+                hs_arg, outfile_arg, ratio_arg, plotkeys_arg = job
+                rtn.append(plot(hs_arg, outfile_arg, ratio_arg, False, **plotkeys_arg))
+            _report(i, job)
+        if show and not close:
+            import matplotlib.pyplot as plt
+            plt.show()
 
     return rtn
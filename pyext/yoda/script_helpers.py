@@ -54,3 +54,28 @@ def filter_aos(aos, match_re=None, unmatch_re=None):
             if re_unmatch.search(k):
                 del aos[k]
     return aos
+
+
+def convert_parallel(in_out, nthreads, informat, outformat, match_re=None, unmatch_re=None, as_scatters=False):
+    """
+    Convert the (infile, outfile) pairs on nthreads threads (0 for one per
+    core), via yoda.convert, and write a summary of each file's throughput to
+    stderr. Returns the number of failed conversions.
+    """
+    import sys, time, yoda
+    t0 = time.time()
+    stats = yoda.convert(list(in_out), informat, outformat, match_re, unmatch_re, as_scatters, nthreads)
+    walltime = time.time() - t0
+    nfail, totbytes = 0, 0
+    for s in stats:
+        if s.error:
+            nfail += 1
+            sys.stderr.write("ERROR converting %s: %s\n" % (s.infile, s.error))
+            continue
+        totbytes += s.inBytes
+        rate = s.inBytes / 1e6 / s.seconds if s.seconds > 0 else 0.0
+        sys.stderr.write("%s -> %s: %d objects, %.2f MB in %.3f s (%.1f MB/s)\n" %
+                         (s.infile, s.outfile, s.numObjects, s.inBytes/1e6, s.seconds, rate))
+    sys.stderr.write("Converted %d/%d files, %.2f MB in %.3f s (%.1f MB/s)\n" %
+                     (len(stats)-nfail, len(stats), totbytes/1e6, walltime, totbytes/1e6/walltime if walltime > 0 else 0.0))
+    return nfail
@@ -0,0 +1,131 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Utils/Binning.h"
+#include <unordered_map>
+#include <functional>
+#include <mutex>
+#include <algorithm>
+using namespace std;
+
+namespace YODA {
+  namespace Utils {
+
+
+    namespace {
+
+      /// Weak references to the binnings in use, by hash, so that unused ones are freed
+      struct Registry {
+        mutex lock;
+        unordered_map< size_t, vector< weak_ptr<const Binning> > > binnings;
+      };
+
+      /// @note Never destroyed, since axes in static objects may outlive any other static
+      Registry& _registry() {
+        static Registry* reg = new Registry();
+        return *reg;
+      }
+
+      void _combine(size_t& seed, size_t h) {
+        seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+      }
+
+      size_t _hashOf(const vector<double>& xedges, const vector<double>& yedges,
+                     const vector<long>& indexes, bool is2d) {
+        size_t rtn = is2d;
+        for (double x : xedges) _combine(rtn, hash<double>()(x));
+        _combine(rtn, xedges.size());
+        for (double y : yedges) _combine(rtn, hash<double>()(y));
+        for (long i : indexes) _combine(rtn, hash<long>()(i));
+        return rtn;
+      }
+
+      /// Whether the searcher was built from exactly @a edges, ignoring its +-inf sentinels
+      bool _sameEdges(const BinSearcher& bs, const vector<double>& edges) {
+        if (bs.size() != edges.size()+2) return false;
+        return equal(edges.begin(), edges.end(), bs.edges().begin()+1);
+      }
+
+    }
+
+
+    Binning::Binning(const vector<double>& xedges, const vector<double>& yedges,
+                     const vector<long>& indexes, bool is2d)
+      : _is2d(is2d), _hash(_hashOf(xedges, yedges, indexes, is2d)),
+        _xsearcher(xedges), _ysearcher(yedges),
+        _indexes(indexes)
+    {  }
+
+
+    bool Binning::_matches(const vector<double>& xedges, const vector<double>& yedges,
+                           const vector<long>& indexes, bool is2d) const {
+      if (is2d != _is2d || indexes != _indexes) return false;
+      return _sameEdges(_xsearcher, xedges) && _sameEdges(_ysearcher, yedges);
+    }
+
+
+    Binning::Ptr Binning::_get(const vector<double>& xedges, const vector<double>& yedges,
+                               const vector<long>& indexes, bool is2d) {
+      Registry& reg = _registry();
+      const size_t h = _hashOf(xedges, yedges, indexes, is2d);
+      // Candidates are released after the lock, since releasing the last use runs the deleter below
+      vector<Ptr> candidates;
+      lock_guard<mutex> guard(reg.lock);
+      vector< weak_ptr<const Binning> >& bucket = reg.binnings[h];
+      for (const weak_ptr<const Binning>& wp : bucket) {
+        candidates.push_back(wp.lock());
+        if (candidates.back() && candidates.back()->_matches(xedges, yedges, indexes, is2d)) return candidates.back();
+      }
+
+      // Not in use: make a new one, which removes itself from the registry when no longer used
+      Ptr rtn(new Binning(xedges, yedges, indexes, is2d), [](const Binning* b) {
+          Registry& reg = _registry();
+          {
+            lock_guard<mutex> guard(reg.lock);
+            auto it = reg.binnings.find(b->_hash);
+            if (it != reg.binnings.end()) {
+              vector< weak_ptr<const Binning> >& bucket = it->second;
+              bucket.erase(remove_if(bucket.begin(), bucket.end(),
+                                     [](const weak_ptr<const Binning>& wp) { return wp.expired(); }),
+                           bucket.end());
+              if (bucket.empty()) reg.binnings.erase(it);
+            }
+          }
+          delete b;
+        });
+      bucket.push_back(rtn);
+      return rtn;
+    }
+
+
+    Binning::Ptr Binning::get(const vector<double>& edges, const vector<long>& indexes) {
+      return _get(edges, vector<double>(), indexes, false);
+    }
+
+
+    Binning::Ptr Binning::get(const vector<double>& xedges, const vector<double>& yedges,
+                              const vector<long>& indexes) {
+      return _get(xedges, yedges, indexes, true);
+    }
+
+
+    Binning::Ptr Binning::empty() {
+      return get(vector<double>(), vector<long>(1, -1));
+    }
+
+
+    size_t Binning::numInstances() {
+      Registry& reg = _registry();
+      lock_guard<mutex> guard(reg.lock);
+      size_t rtn = 0;
+      for (const auto& kv : reg.binnings)
+        for (const weak_ptr<const Binning>& wp : kv.second)
+          if (!wp.expired()) rtn += 1;
+      return rtn;
+    }
+
+
+  }
+}
@@ -0,0 +1,115 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Checkpoint.h"
+#include "YODA/WriterYODA.h"
+#include "YODA/Reader.h"
+#include "YODA/Serialize.h"
+#include "YODA/Exceptions.h"
+#include "YODA/Utils/StringUtils.h"
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <functional>
+using namespace std;
+
+namespace YODA {
+
+
+  CheckpointWriter::CheckpointWriter(const string& filename, const WriterOptions& opts)
+    : _filename(filename), _writer(mkWriter(filename, opts))
+  {
+    // Other formats have a head and foot around the objects, so can't simply be appended to
+    if (!dynamic_cast<WriterYODA*>(_writer.get()))
+      throw UserError("Checkpoint files must be in YODA format: can't write " + filename);
+  }
+
+
+  size_t CheckpointWriter::write(const vector<const AnalysisObject*>& aos) {
+    // Find the new and changed objects, keeping their hashes to be stored once written
+    vector<const AnalysisObject*> changed;
+    vector< pair<string,size_t> > newhashes;
+    for (const AnalysisObject* ao : aos) {
+      size_t h;
+      try {
+        h = hash<string>()(serialize(*ao));
+      } catch (const WriteError&) {
+        // Types without a binary encoding are always written
+        changed.push_back(ao);
+        continue;
+      }
+      const auto ih = _hashes.find(ao->path());
+      if (ih != _hashes.end() && ih->second == h) continue;
+      changed.push_back(ao);
+      newhashes.push_back(make_pair(ao->path(), h));
+    }
+
+    if (_numCheckpoints == 0 || !changed.empty()) {
+      ostringstream oss;
+      if (_numCheckpoints > 0 && !Utils::endswith(Utils::toLower(_filename), ".gz")) oss << "\n";
+      _writer->write(oss, changed);
+      ofstream f(_filename.c_str(), ios::binary | (_numCheckpoints == 0 ? ios::trunc : ios::app));
+      if (!f) throw WriteError("Couldn't open checkpoint file " + _filename + " for writing");
+      f << oss.str();
+      f.close();
+      if (!f) throw WriteError("Writing to checkpoint file " + _filename + " failed");
+    }
+
+    for (const auto& ph : newhashes) _hashes[ph.first] = ph.second;
+    _numCheckpoints += 1;
+    return changed.size();
+  }
+
+
+  void CheckpointWriter::reset() {
+    _hashes.clear();
+    _numCheckpoints = 0;
+  }
+
+
+  vector<AnalysisObject*> readCheckpoint(const string& filename) {
+    vector<AnalysisObject*> aos;
+    mkReader(filename).read(filename, aos);
+    // Replace earlier versions of each path with the last, in the first one's position
+    vector<AnalysisObject*> rtn;
+    unordered_map<string,size_t> index;
+    for (AnalysisObject* ao : aos) {
+      const auto ii = index.find(ao->path());
+      if (ii == index.end()) {
+        index[ao->path()] = rtn.size();
+        rtn.push_back(ao);
+      } else {
+        delete rtn[ii->second];
+        rtn[ii->second] = ao;
+      }
+    }
+    return rtn;
+  }
+
+
+  size_t compactCheckpoint(const string& filename, const string& outfile) {
+    vector<AnalysisObject*> aos = readCheckpoint(filename);
+    vector< unique_ptr<AnalysisObject> > owned(aos.begin(), aos.end());
+
+    // Write to a temporary file next to the target and move it into place, so the
+    // checkpoint is never left half-written, compressing according to the target's name
+    const string target = outfile.empty() ? filename : outfile;
+    const string tmpfile = target + ".compacting";
+    {
+      ofstream f(tmpfile.c_str(), ios::binary | ios::trunc);
+      if (!f) throw WriteError("Couldn't open " + tmpfile + " for writing");
+      mkWriter(target, WriterOptions())->write(f, aos);
+      f.close();
+      if (!f) throw WriteError("Writing to " + tmpfile + " failed");
+    }
+    if (rename(tmpfile.c_str(), target.c_str()) != 0) {
+      remove(tmpfile.c_str());
+      throw WriteError("Couldn't replace " + target + " with its compacted version");
+    }
+    return aos.size();
+  }
+
+
+}
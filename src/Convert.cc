@@ -0,0 +1,115 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Convert.h"
+#include "YODA/Reader.h"
+#include "YODA/Writer.h"
+#include "YODA/Counter.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Profile2D.h"
+#include "YODA/Scatter1D.h"
+#include "YODA/Scatter2D.h"
+#include "YODA/Scatter3D.h"
+#include "YODA/Exceptions.h"
+
+#include <fstream>
+#include <memory>
+#include <regex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+using namespace std;
+
+namespace YODA {
+
+
+  namespace {
+
+    /// Newly allocated scatter representation of @a ao
+    AnalysisObject* _mkScatter(const AnalysisObject& ao) {
+      if (const Counter* c = dynamic_cast<const Counter*>(&ao)) return mkScatter(*c).newclone();
+      if (const Histo1D* h1 = dynamic_cast<const Histo1D*>(&ao)) return mkScatter(*h1).newclone();
+      if (const Histo2D* h2 = dynamic_cast<const Histo2D*>(&ao)) return mkScatter(*h2).newclone();
+      if (const Profile1D* p1 = dynamic_cast<const Profile1D*>(&ao)) return mkScatter(*p1).newclone();
+      if (const Profile2D* p2 = dynamic_cast<const Profile2D*>(&ao)) return mkScatter(*p2).newclone();
+      return ao.newclone();
+    }
+
+
+    /// Size of file @a filename, or 0 for "-" or an unreadable file
+    size_t _fileSize(const string& filename) {
+      if (filename == "-") return 0;
+      ifstream f(filename.c_str(), ios::binary | ios::ate);
+      return f ? size_t(f.tellg()) : 0;
+    }
+
+
+    void _convertOne(const string& infile, const string& outfile, Writer& writer,
+                     const regex* match, const regex* unmatch, const ConvertOptions& opts, ConvertStats& stats) {
+      const auto start = chrono::steady_clock::now();
+      stats.infile = infile;
+      stats.outfile = outfile;
+      stats.inBytes = _fileSize(infile);
+
+      // Read, keeping only the objects to be written
+      Reader& reader = mkReader(opts.inFormat.empty() ? infile : opts.inFormat);
+      vector<AnalysisObject*> aos;
+      reader.read(infile, aos);
+      vector< unique_ptr<AnalysisObject> > owned;
+      owned.reserve(aos.size());
+      for (AnalysisObject* ao : aos) {
+        unique_ptr<AnalysisObject> p(ao);
+        if (match && !regex_search(ao->path(), *match)) continue;
+        if (unmatch && regex_search(ao->path(), *unmatch)) continue;
+        if (opts.asScatters) p.reset(_mkScatter(*ao));
+        owned.push_back(move(p));
+      }
+      vector<const AnalysisObject*> outaos;
+      for (const auto& p : owned) outaos.push_back(p.get());
+
+      writer.write(outfile, outaos);
+
+      stats.numObjects = outaos.size();
+      stats.outBytes = _fileSize(outfile);
+      stats.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+  }
+
+
+  vector<ConvertStats> convert(const vector< pair<string,string> >& inout, const ConvertOptions& opts) {
+    const unique_ptr<regex> match(opts.match.empty() ? nullptr : new regex(opts.match));
+    const unique_ptr<regex> unmatch(opts.unmatch.empty() ? nullptr : new regex(opts.unmatch));
+
+    // Make all the writers up front, so that bad output formats are reported before any work is done
+    vector< unique_ptr<Writer> > writers;
+    for (const auto& io : inout)
+      writers.push_back(mkWriter(opts.outFormat.empty() ? io.second : opts.outFormat, WriterOptions()));
+
+    vector<ConvertStats> stats(inout.size());
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+      for (size_t i = next++; i < inout.size(); i = next++) {
+        try {
+          _convertOne(inout[i].first, inout[i].second, *writers[i], match.get(), unmatch.get(), opts, stats[i]);
+        } catch (const std::exception& e) {
+          stats[i].error = e.what();
+        }
+      }
+    };
+    const size_t nthreads = min((opts.nthreads > 0) ? opts.nthreads : max<size_t>(thread::hardware_concurrency(), 1),
+                                max<size_t>(inout.size(), 1));
+    vector<thread> threads;
+    for (size_t i = 1; i < nthreads; ++i) threads.push_back(thread(worker));
+    worker();
+    for (thread& t : threads) t.join();
+    return stats;
+  }
+
+
+}
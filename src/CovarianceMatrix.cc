@@ -0,0 +1,109 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/CovarianceMatrix.h"
+#include "YODA/Exceptions.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace YODA {
+
+
+  namespace {
+
+    /// Edge length of the square tiles the rank-k update is split into
+    const size_t TILE = 64;
+
+    /// Amount of multiply-adds below which extra threads aren't worth starting
+    const size_t MIN_WORK_PER_THREAD = 1 << 20;
+
+    /// Accumulate one tile of the upper triangle, rows [i0,i1) x columns [j0,j1)
+    void _addTile(double* cov, const double* errs, size_t n, size_t nvars,
+                  size_t i0, size_t i1, size_t j0, size_t j1) {
+      for (size_t k = 0; k < nvars; ++k) {
+        const double* ek = errs + k*n;
+        for (size_t i = i0; i < i1; ++i) {
+          const double eki = ek[i];
+          double* row = cov + i*n;
+          for (size_t j = std::max(i, j0); j < j1; ++j) row[j] += eki * ek[j];
+        }
+      }
+    }
+
+  }
+
+
+  std::vector<std::vector<double> > CovarianceMatrix::asVectors() const {
+    std::vector<std::vector<double> > rtn(_n);
+    for (size_t i = 0; i < _n; ++i) {
+      rtn[i].assign(_data.begin() + i*_n, _data.begin() + (i+1)*_n);
+    }
+    return rtn;
+  }
+
+
+  void CovarianceMatrix::addOuterProducts(const std::vector<double>& errs, size_t nvars, size_t nthreads) {
+    if (errs.size() != nvars*_n)
+      throw UserError("Error array size doesn't match the covariance matrix dimension");
+    if (_n == 0 || nvars == 0) return;
+
+    // List the tiles of the upper triangle
+    std::vector<std::pair<size_t,size_t> > tiles;
+    for (size_t i0 = 0; i0 < _n; i0 += TILE) {
+      for (size_t j0 = i0; j0 < _n; j0 += TILE) tiles.push_back(std::make_pair(i0, j0));
+    }
+
+    // Choose the number of workers: never more than the cores, tiles, or work justifies
+    const size_t work = nvars * _n * (_n+1) / 2;
+    if (nthreads == 0) {
+      nthreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+      nthreads = std::min(nthreads, std::max<size_t>(work / MIN_WORK_PER_THREAD, 1));
+    }
+    nthreads = std::min(nthreads, tiles.size());
+
+    // Tiles are disjoint, so the workers just pull the next one off a shared counter
+    double* cov = _data.data();
+    const double* e = errs.data();
+    const size_t n = _n;
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+      for (size_t t = next++; t < tiles.size(); t = next++) {
+        const size_t i0 = tiles[t].first, j0 = tiles[t].second;
+        _addTile(cov, e, n, nvars, i0, std::min(i0+TILE, n), j0, std::min(j0+TILE, n));
+      }
+    };
+    std::vector<std::thread> threads;
+    for (size_t it = 1; it < nthreads; ++it) threads.push_back(std::thread(worker));
+    worker();
+    for (std::thread& t : threads) t.join();
+
+    // Mirror the upper triangle into the lower one
+    for (size_t i = 0; i < _n; ++i) {
+      for (size_t j = 0; j < i; ++j) _data[i*_n + j] = _data[j*_n + i];
+    }
+  }
+
+
+  void CovarianceMatrix::addDiagonal(const std::vector<double>& errs, size_t nvars) {
+    if (errs.size() != nvars*_n)
+      throw UserError("Error array size doesn't match the covariance matrix dimension");
+    for (size_t k = 0; k < nvars; ++k) {
+      for (size_t i = 0; i < _n; ++i) {
+        const double e = errs[k*_n + i];
+        _data[i*_n + i] += e*e;
+      }
+    }
+  }
+
+
+  CovarianceMatrix& CovarianceMatrix::operator += (const CovarianceMatrix& other) {
+    if (other._n != _n) throw UserError("Can't add covariance matrices of different dimensions");
+    for (size_t i = 0; i < _data.size(); ++i) _data[i] += other._data[i];
+    return *this;
+  }
+
+
+}
@@ -0,0 +1,197 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/FillText.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Profile2D.h"
+#include "YODA/Exceptions.h"
+#include "YODA/Config/DummyConfig.h"
+
+#ifdef HAVE_LIBZ
+#define _XOPEN_SOURCE 700
+#include "zstr/zstr.hpp"
+#endif
+
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <exception>
+#include <functional>
+using namespace std;
+
+namespace YODA {
+
+
+  namespace {
+
+    /// Number of fill coordinates, and the fill call, for each fillable type
+    template <typename H> struct TextFill;
+
+    template <> struct TextFill<Histo1D> {
+      static const size_t NCOORDS = 1;
+      static void fill(Histo1D& h, const double* v, double w) { h.fill(v[0], w); }
+    };
+
+    template <> struct TextFill<Histo2D> {
+      static const size_t NCOORDS = 2;
+      static void fill(Histo2D& h, const double* v, double w) { h.fill(v[0], v[1], w); }
+    };
+
+    template <> struct TextFill<Profile1D> {
+      static const size_t NCOORDS = 2;
+      static void fill(Profile1D& p, const double* v, double w) { p.fill(v[0], v[1], w); }
+    };
+
+    template <> struct TextFill<Profile2D> {
+      static const size_t NCOORDS = 3;
+      static void fill(Profile2D& p, const double* v, double w) { p.fill(v[0], v[1], v[2], w); }
+    };
+
+
+    /// Bytes of input parsed by each thread per block
+    const size_t BLOCKSIZE = 1 << 22;
+
+
+    /// Error for a row which can't be filled into a @a type with @a ncoords coordinates
+    ReadError _badRow(const string& type, size_t ncoords, const char* b, const char* eol) {
+      if (eol > b && eol[-1] == '\r') --eol;
+      return ReadError("Bad row for filling a " + type + " from text, which needs " + to_string(ncoords) +
+                       " numbers and an optional weight per row: '" + string(b, eol) + "'");
+    }
+
+
+    /// @brief Parse and fill the rows in [b, e), returning the number filled
+    ///
+    /// The text must end with a newline or a NUL, which stops strtod at the end.
+    template <typename H>
+    size_t _fillRows(H& h, const char* b, const char* e) {
+      const size_t N = TextFill<H>::NCOORDS;
+      double vals[N+1];
+      size_t nrows = 0;
+      while (b < e) {
+        const char* eol = static_cast<const char*>(memchr(b, '\n', e - b));
+        if (eol == nullptr) eol = e;
+        size_t nvals = 0;
+        for (const char* p = b; ; ) {
+          while (p < eol && (*p == ' ' || *p == '\t' || *p == ',' || *p == '\r')) ++p;
+          if (p == eol || *p == '#') break;
+          char* end;
+          const double x = strtod(p, &end);
+          if (end == p || nvals == N+1) throw _badRow(h.type(), N, b, eol);
+          vals[nvals++] = x;
+          p = end;
+        }
+        if (nvals > 0) {
+          if (nvals < N) throw _badRow(h.type(), N, b, eol);
+          TextFill<H>::fill(h, vals, nvals > N ? vals[N] : 1.0);
+          nrows += 1;
+        }
+        b = eol + 1;
+      }
+      return nrows;
+    }
+
+
+    /// Read the stream block by block, sharing each block's rows out over the threads
+    template <typename H>
+    size_t _fillFromStream(H& h, istream& is, size_t nthreads) {
+      // Thread 0 fills h itself, the others fill empty copies which are added at the end
+      vector< unique_ptr<H> > copies(nthreads);
+      for (size_t i = 1; i < nthreads; ++i) {
+        copies[i].reset(new H(h));
+        copies[i]->reset();
+      }
+      vector<H*> targets(nthreads, &h);
+      for (size_t i = 1; i < nthreads; ++i) targets[i] = copies[i].get();
+
+      size_t nrows = 0;
+      vector<char> buf;
+      size_t ncarry = 0; //< length of the incomplete last line of the previous block, kept at the front
+      vector<size_t> counts(nthreads);
+      vector<exception_ptr> errs(nthreads);
+      bool last = false;
+      while (!last) {
+        buf.resize(ncarry + nthreads*BLOCKSIZE + 1);
+        is.read(&buf[ncarry], nthreads*BLOCKSIZE);
+        const size_t nread = ncarry + is.gcount();
+        last = !is;
+
+        // Stop this block at its last newline, unless there's no more input to come
+        size_t end = nread;
+        if (!last) {
+          while (end > 0 && buf[end-1] != '\n') --end;
+          if (end == 0) { //< a single line longer than the whole block
+            ncarry = nread;
+            continue;
+          }
+        }
+        const string carry(&buf[end], nread - end);
+        buf[end] = '\0';
+
+        // Split the block into a segment per thread, at line boundaries
+        vector<size_t> splits(nthreads+1, end);
+        splits[0] = 0;
+        for (size_t i = 1; i < nthreads; ++i) {
+          size_t pos = max(splits[i-1], i*end/nthreads);
+          while (pos > 0 && pos < end && buf[pos-1] != '\n') ++pos;
+          splits[i] = pos;
+        }
+        auto job = [&](size_t i) {
+          try {
+            counts[i] = _fillRows(*targets[i], &buf[splits[i]], &buf[splits[i+1]]);
+          } catch (...) {
+            errs[i] = current_exception();
+          }
+        };
+        vector<thread> threads;
+        for (size_t i = 1; i < nthreads; ++i) threads.push_back(thread(job, i));
+        job(0);
+        for (thread& t : threads) t.join();
+        for (size_t i = 0; i < nthreads; ++i) {
+          if (errs[i]) rethrow_exception(errs[i]);
+          nrows += counts[i];
+        }
+
+        std::copy(carry.begin(), carry.end(), buf.begin());
+        ncarry = carry.size();
+      }
+
+      for (size_t i = 1; i < nthreads; ++i) h += *copies[i];
+      return nrows;
+    }
+
+  }
+
+
+  size_t fillFromText(AnalysisObject& ao, istream& stream_, size_t nthreads) {
+    #ifdef HAVE_LIBZ
+    // NB. zstr auto-detects if file is deflated or plain-text
+    zstr::istream stream(stream_);
+    #else
+    istream& stream = stream_;
+    #endif
+    if (nthreads == 0) nthreads = max<size_t>(thread::hardware_concurrency(), 1);
+    if (Histo1D* h1 = dynamic_cast<Histo1D*>(&ao)) return _fillFromStream(*h1, stream, nthreads);
+    if (Histo2D* h2 = dynamic_cast<Histo2D*>(&ao)) return _fillFromStream(*h2, stream, nthreads);
+    if (Profile1D* p1 = dynamic_cast<Profile1D*>(&ao)) return _fillFromStream(*p1, stream, nthreads);
+    if (Profile2D* p2 = dynamic_cast<Profile2D*>(&ao)) return _fillFromStream(*p2, stream, nthreads);
+    throw UserError("Can't fill a " + ao.type() + " from text: only histograms and profiles are supported");
+  }
+
+
+  size_t fillFromText(AnalysisObject& ao, const string& filename, size_t nthreads) {
+    if (filename == "-") return fillFromText(ao, cin, nthreads);
+    ifstream instream(filename.c_str(), ios::binary);
+    if (!instream) throw ReadError("Couldn't open file " + filename + " for filling " + ao.path());
+    return fillFromText(ao, instream, nthreads);
+  }
+
+
+}
@@ -6,6 +6,7 @@
 #include "YODA/Histo1D.h"
 #include "YODA/Profile1D.h"
 #include "YODA/Scatter2D.h"
+#include "YODA/Stats.h"
 #include "YODA/Utils/StringUtils.h"
 
 using namespace std;
@@ -14,7 +15,10 @@ namespace YODA {
 
 
   void Histo1D::fill(double x, double weight, double fraction) {
-    if ( std::isnan(x) ) throw RangeError("X is NaN");
+    if ( std::isnan(x) ) {
+      YODA_STATS_COUNT(HISTO1D_FILL_NAN);
+      throw RangeError("X is NaN");
+    }
 
     // Fill the overall distribution
     _axis.totalDbn().fill(x, weight, fraction);
@@ -25,11 +29,16 @@ namespace YODA {
       try {
         /// @todo Replace try block with a check that there is a bin at x
         _binAt(x).fill(x, weight, fraction);
-      } catch (const RangeError& re) {    }
+        YODA_STATS_COUNT(HISTO1D_FILL_INRANGE);
+      } catch (const RangeError& re) {
+        YODA_STATS_COUNT(HISTO1D_FILL_GAP);
+      }
     } else if (x < _axis.xMin()) {
       _axis.underflow().fill(x, weight, fraction);
+      YODA_STATS_COUNT(HISTO1D_FILL_UNDERFLOW);
     } else if (x >= _axis.xMax()) {
       _axis.overflow().fill(x, weight, fraction);
+      YODA_STATS_COUNT(HISTO1D_FILL_OVERFLOW);
     }
 
     // Lock the axis now that a fill has happened
@@ -153,13 +162,18 @@ namespace YODA {
   Scatter2D divide(const Histo1D& numer, const Histo1D& denom) {
     Scatter2D rtn;
 
+    std::vector<Point2D> points;
+    points.reserve(numer.numBins());
+    // Axes booked with the same binning share it, making this usually a pointer comparison
+    const bool samebinning = numer.sameBinning(denom);
     for (size_t i = 0; i < numer.numBins(); ++i) {
       const HistoBin1D& b1 = numer.bin(i);
       const HistoBin1D& b2 = denom.bin(i);
 
-      /// @todo Create a compatibleBinning function? Or just compare vectors of edges().
-      if (!fuzzyEquals(b1.xMin(), b2.xMin()) || !fuzzyEquals(b1.xMax(), b2.xMax()))
-        throw BinningError("x binnings are not equivalent in " + numer.path() + " / " + denom.path());
+      if (!samebinning) {
+        if (!fuzzyEquals(b1.xMin(), b2.xMin()) || !fuzzyEquals(b1.xMax(), b2.xMax()))
+          throw BinningError("x binnings are not equivalent in " + numer.path() + " / " + denom.path());
+      }
 
       // Assemble the x value and error
       // Use the midpoint of the "bin" for the new central x value, in the absence of better information
@@ -186,8 +200,9 @@ namespace YODA {
       /// @todo check correctness with different signed numerator and denominator.
       //const double eyplus = y * sqrt( sqr(p1.yErrPlus()/p1.y()) + sqr(p2.yErrMinus()/p2.y()) );
       //const double eyminus = y * sqrt( sqr(p1.yErrMinus()/p1.y()) + sqr(p2.yErrPlus()/p2.y()) );
-      rtn.addPoint(x, y, exminus, explus, ey, ey);
+      points.push_back(Point2D(x, y, exminus, explus, ey, ey));
     }
+    rtn.addPoints(points);
 
     assert(rtn.numPoints() == numer.numBins());
     return rtn;
@@ -316,15 +316,20 @@ namespace YODA {
   Scatter3D divide(const Histo2D& numer, const Histo2D& denom) {
     Scatter3D rtn;
 
+    std::vector<Point3D> points;
+    points.reserve(numer.numBins());
+    // Axes booked with the same binning share it, making this usually a pointer comparison
+    const bool samebinning = numer.sameBinning(denom);
     for (size_t i = 0; i < numer.numBins(); ++i) {
       const HistoBin2D& b1 = numer.bin(i);
       const HistoBin2D& b2 = denom.bin(i);
 
-      /// @todo Create a compatibleBinning function? Or just compare vectors of edges().
-      if (!fuzzyEquals(b1.xMin(), b2.xMin()) || !fuzzyEquals(b1.xMax(), b2.xMax()))
-        throw BinningError("x binnings are not equivalent in " + numer.path() + " / " + denom.path());
-      if (!fuzzyEquals(b1.yMin(), b2.yMin()) || !fuzzyEquals(b1.yMax(), b2.yMax()))
-        throw BinningError("y binnings are not equivalent in " + numer.path() + " / " + denom.path());
+      if (!samebinning) {
+        if (!fuzzyEquals(b1.xMin(), b2.xMin()) || !fuzzyEquals(b1.xMax(), b2.xMax()))
+          throw BinningError("x binnings are not equivalent in " + numer.path() + " / " + denom.path());
+        if (!fuzzyEquals(b1.yMin(), b2.yMin()) || !fuzzyEquals(b1.yMax(), b2.yMax()))
+          throw BinningError("y binnings are not equivalent in " + numer.path() + " / " + denom.path());
+      }
 
       // Assemble the x value and error
       // Use the midpoint of the "bin" for the new central x value, in the absence of better information
@@ -356,8 +361,9 @@ namespace YODA {
       /// @todo check correctness with different signed numerator and denominator.
       //const double eyplus = y * sqrt( sqr(p1.yErrPlus()/p1.y()) + sqr(p2.yErrMinus()/p2.y()) );
       //const double eyminus = y * sqrt( sqr(p1.yErrMinus()/p1.y()) + sqr(p2.yErrPlus()/p2.y()) );
-      rtn.addPoint(x, y, z, exminus, explus, eyminus, eyplus, ez, ez);
+      points.push_back(Point3D(x, y, z, exminus, explus, eyminus, eyplus, ez, ez));
     }
+    rtn.addPoints(points);
 
     assert(rtn.numPoints() == numer.numBins());
     return rtn;
@@ -0,0 +1,61 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Integrals.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace YODA {
+
+
+  namespace {
+
+    /// Index of the edge nearest to @a x, since the axis merges edges within rounding
+    size_t _nearestEdge(const vector<double>& edges, double x) {
+      const size_t i = lower_bound(edges.begin(), edges.end(), x) - edges.begin();
+      if (i == edges.size()) return i-1;
+      if (i > 0 && fabs(x - edges[i-1]) < fabs(edges[i] - x)) return i-1;
+      return i;
+    }
+
+  }
+
+
+  Histo1DIntegrals::Histo1DIntegrals(const Histo1D& h)
+    : _underflow(h.underflow().sumW())
+  {
+    _cumsumw.reserve(h.numBins()+1);
+    _cumsumw.push_back(0);
+    for (const HistoBin1D& b : h.bins())
+      _cumsumw.push_back(_cumsumw.back() + b.sumW());
+  }
+
+
+  Histo2DIntegrals::Histo2DIntegrals(const Histo2D& h) {
+    const vector<double> xedges = h.xEdges(), yedges = h.yEdges();
+    _ncx = h.numBins() > 0 ? xedges.size()-1 : 0;
+    _ncy = h.numBins() > 0 ? yedges.size()-1 : 0;
+
+    // Put each bin's weight in its lowest cell, then accumulate along both axes
+    vector<double> cells(_ncx*_ncy, 0.0);
+    for (const HistoBin2D& b : h.bins()) {
+      const size_t ix = min(_nearestEdge(xedges, b.xMin()), _ncx-1);
+      const size_t iy = min(_nearestEdge(yedges, b.yMin()), _ncy-1);
+      cells[iy*_ncx + ix] += b.sumW();
+    }
+    _table.assign((_ncx+1)*(_ncy+1), 0.0);
+    for (size_t iy = 0; iy < _ncy; ++iy) {
+      double rowsum = 0;
+      for (size_t ix = 0; ix < _ncx; ++ix) {
+        rowsum += cells[iy*_ncx + ix];
+        _table[(iy+1)*(_ncx+1) + ix+1] = _table[iy*(_ncx+1) + ix+1] + rowsum;
+      }
+    }
+  }
+
+
+}
@@ -0,0 +1,244 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/LiveExport.h"
+#include "YODA/Serialize.h"
+#include "YODA/Exceptions.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstring>
+#include <cerrno>
+#include <memory>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+using namespace std;
+
+namespace YODA {
+
+
+  namespace {
+
+    /// Leading word of a segment, which also catches byte-order mismatches
+    const uint32_t MAGIC = 0x594c5631; //< "YLV1"
+
+    /// @brief Start of the segment
+    ///
+    /// It is followed by the byte offsets of the object slots, as uint64_t.
+    struct SegmentHeader {
+      uint32_t magic;
+      uint32_t numObjects;
+      uint64_t size;
+      atomic<uint64_t> updates;
+    };
+
+    /// @brief Start of an object's slot
+    ///
+    /// It is followed by the path, padded to a multiple of 8 bytes, then
+    /// the capacity bytes for the encoded object, of which size are in use.
+    struct SlotHeader {
+      atomic<uint64_t> seq;
+      uint64_t capacity;
+      uint64_t size;
+      uint64_t pathSize;
+    };
+
+    size_t _pad8(size_t n) { return (n + 7) & ~size_t(7); }
+
+    string _shmName(const string& name) {
+      return (!name.empty() && name[0] == '/') ? name : "/" + name;
+    }
+
+    string _errnoStr() { return strerror(errno); }
+
+  }
+
+
+  LiveExport::LiveExport(const string& name, const vector<const AnalysisObject*>& aos)
+    : _name(_shmName(name)), _aos(aos)
+  {
+    if (!atomic<uint64_t>().is_lock_free())
+      throw UserError("Live export needs lock-free 64-bit atomics, which this platform lacks");
+
+    // Lay out the slots, with room for each encoding to grow by a quarter, and by a few annotations
+    vector<string> encs;
+    vector<size_t> offsets, capacities;
+    size_t pos = _pad8(sizeof(SegmentHeader) + aos.size()*sizeof(uint64_t));
+    for (const AnalysisObject* ao : aos) {
+      encs.push_back(serialize(*ao));
+      offsets.push_back(pos);
+      capacities.push_back(_pad8(encs.back().size() + encs.back().size()/4 + 1024));
+      pos += sizeof(SlotHeader) + _pad8(ao->path().size()) + capacities.back();
+    }
+    _size = pos;
+
+    // Create and map the segment, replacing any stale one of the same name
+    shm_unlink(_name.c_str());
+    const int fd = shm_open(_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) throw WriteError("Couldn't create shared memory segment " + _name + ": " + _errnoStr());
+    if (ftruncate(fd, _size) != 0) {
+      const string err = _errnoStr();
+      close(fd);
+      shm_unlink(_name.c_str());
+      throw WriteError("Couldn't size shared memory segment " + _name + ": " + err);
+    }
+    void* mem = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) {
+      shm_unlink(_name.c_str());
+      throw WriteError("Couldn't map shared memory segment " + _name + ": " + _errnoStr());
+    }
+    _mem = static_cast<char*>(mem);
+
+    // Fill in the headers and the initial state, then mark the segment as ready by its magic word
+    SegmentHeader* hdr = new (_mem) SegmentHeader();
+    hdr->numObjects = aos.size();
+    hdr->size = _size;
+    hdr->updates.store(0);
+    uint64_t* offs = reinterpret_cast<uint64_t*>(_mem + sizeof(SegmentHeader));
+    for (size_t i = 0; i < aos.size(); ++i) {
+      offs[i] = offsets[i];
+      SlotHeader* slot = new (_mem + offsets[i]) SlotHeader();
+      const string& path = aos[i]->path();
+      slot->seq.store(0);
+      slot->pathSize = path.size();
+      slot->capacity = capacities[i];
+      slot->size = encs[i].size();
+      char* data = _mem + offsets[i] + sizeof(SlotHeader);
+      memcpy(data, path.data(), path.size());
+      memcpy(data + _pad8(path.size()), encs[i].data(), encs[i].size());
+    }
+    atomic_thread_fence(memory_order_release);
+    hdr->magic = MAGIC;
+    hdr->updates.store(1, memory_order_release);
+  }
+
+
+  LiveExport::~LiveExport() {
+    if (_mem) munmap(_mem, _size);
+    shm_unlink(_name.c_str());
+  }
+
+
+  void LiveExport::update() {
+    SegmentHeader* hdr = reinterpret_cast<SegmentHeader*>(_mem);
+    const uint64_t* offs = reinterpret_cast<const uint64_t*>(_mem + sizeof(SegmentHeader));
+    for (size_t i = 0; i < _aos.size(); ++i) {
+      const string enc = serialize(*_aos[i]);
+      SlotHeader* slot = reinterpret_cast<SlotHeader*>(_mem + offs[i]);
+      if (enc.size() > slot->capacity)
+        throw WriteError("Object " + _aos[i]->path() + " has outgrown its slot in shared memory segment " + _name);
+      // Seqlock write: the odd sequence number tells readers to retry
+      const uint64_t seq = slot->seq.load(memory_order_relaxed);
+      slot->seq.store(seq + 1, memory_order_relaxed);
+      atomic_thread_fence(memory_order_release);
+      slot->size = enc.size();
+      memcpy(_mem + offs[i] + sizeof(SlotHeader) + _pad8(slot->pathSize), enc.data(), enc.size());
+      slot->seq.store(seq + 2, memory_order_release);
+    }
+    hdr->updates.fetch_add(1, memory_order_release);
+  }
+
+
+  LiveReader::LiveReader(const string& name)
+    : _name(_shmName(name))
+  {
+    const int fd = shm_open(_name.c_str(), O_RDONLY, 0);
+    if (fd < 0) throw ReadError("Couldn't open shared memory segment " + _name + ": " + _errnoStr());
+    struct stat st;
+    if (fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(SegmentHeader)) {
+      close(fd);
+      throw ReadError("Shared memory segment " + _name + " is not a YODA live export");
+    }
+    _size = st.st_size;
+    void* mem = mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mem == MAP_FAILED) throw ReadError("Couldn't map shared memory segment " + _name + ": " + _errnoStr());
+    _mem = static_cast<const char*>(mem);
+
+    // Check that the layout is complete and self-consistent before trusting any offsets
+    const SegmentHeader* hdr = reinterpret_cast<const SegmentHeader*>(_mem);
+    bool ok = hdr->updates.load(memory_order_acquire) > 0 && hdr->magic == MAGIC && hdr->size == _size &&
+      sizeof(SegmentHeader) + hdr->numObjects*sizeof(uint64_t) <= _size;
+    const uint64_t* offs = reinterpret_cast<const uint64_t*>(_mem + sizeof(SegmentHeader));
+    for (size_t i = 0; ok && i < hdr->numObjects; ++i) {
+      const SlotHeader* slot = reinterpret_cast<const SlotHeader*>(_mem + offs[i]);
+      ok = offs[i] % 8 == 0 && offs[i] + sizeof(SlotHeader) <= _size &&
+        slot->pathSize <= _size && slot->capacity <= _size &&
+        offs[i] + sizeof(SlotHeader) + _pad8(slot->pathSize) + slot->capacity <= _size;
+    }
+    if (!ok) {
+      munmap(const_cast<char*>(_mem), _size);
+      throw ReadError("Shared memory segment " + _name + " is not a complete YODA live export");
+    }
+  }
+
+
+  LiveReader::~LiveReader() {
+    if (_mem) munmap(const_cast<char*>(_mem), _size);
+  }
+
+
+  size_t LiveReader::numObjects() const {
+    return reinterpret_cast<const SegmentHeader*>(_mem)->numObjects;
+  }
+
+
+  string LiveReader::path(size_t i) const {
+    if (i >= numObjects()) throw RangeError("Live export object index out of range");
+    const uint64_t* offs = reinterpret_cast<const uint64_t*>(_mem + sizeof(SegmentHeader));
+    const SlotHeader* slot = reinterpret_cast<const SlotHeader*>(_mem + offs[i]);
+    return string(_mem + offs[i] + sizeof(SlotHeader), slot->pathSize);
+  }
+
+
+  uint64_t LiveReader::numUpdates() const {
+    return reinterpret_cast<const SegmentHeader*>(_mem)->updates.load(memory_order_acquire);
+  }
+
+
+  AnalysisObject* LiveReader::snapshot(size_t i) const {
+    if (i >= numObjects()) throw RangeError("Live export object index out of range");
+    const uint64_t* offs = reinterpret_cast<const uint64_t*>(_mem + sizeof(SegmentHeader));
+    const SlotHeader* slot = reinterpret_cast<const SlotHeader*>(_mem + offs[i]);
+    const char* data = _mem + offs[i] + sizeof(SlotHeader) + _pad8(slot->pathSize);
+    unique_ptr<char[]> buf(new char[slot->capacity]);
+    const auto start = chrono::steady_clock::now();
+    for (size_t ntries = 1; ; ++ntries) {
+      // Seqlock read: copy, then check that no write started or finished meanwhile
+      const uint64_t seq = slot->seq.load(memory_order_acquire);
+      if (seq % 2 == 0) {
+        const size_t size = min<size_t>(slot->size, slot->capacity);
+        memcpy(buf.get(), data, size);
+        atomic_thread_fence(memory_order_acquire);
+        if (slot->seq.load(memory_order_relaxed) == seq) return deserialize(buf.get(), size);
+      }
+      if (ntries % 64 == 0) {
+        if (chrono::steady_clock::now() - start > chrono::seconds(1))
+          throw ReadError("Object " + path(i) + " in shared memory segment " + _name + " is stuck mid-update");
+        this_thread::yield();
+      }
+    }
+  }
+
+
+  vector<AnalysisObject*> LiveReader::snapshot() const {
+    vector< unique_ptr<AnalysisObject> > owned;
+    for (size_t i = 0; i < numObjects(); ++i) owned.emplace_back(snapshot(i));
+    vector<AnalysisObject*> rtn;
+    for (auto& p : owned) rtn.push_back(p.release());
+    return rtn;
+  }
+
+
+  vector<AnalysisObject*> readLive(const string& name) {
+    return LiveReader(name).snapshot();
+  }
+
+
+}
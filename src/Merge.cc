@@ -0,0 +1,501 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Merge.h"
+#include "YODA/Reader.h"
+#include "YODA/Counter.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Profile2D.h"
+#include "YODA/Scatter1D.h"
+#include "YODA/Scatter2D.h"
+#include "YODA/Scatter3D.h"
+#include "YODA/Exceptions.h"
+#include <map>
+#include <set>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <exception>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+using namespace std;
+
+namespace YODA {
+
+
+  MergeOptions::ScatterMode mkScatterMergeMode(const string& name) {
+    if (name == "first") return MergeOptions::SCATTER_FIRST;
+    if (name == "combine") return MergeOptions::SCATTER_COMBINE;
+    if (name == "assume_mean") return MergeOptions::SCATTER_ASSUME_MEAN;
+    if (name == "add") return MergeOptions::SCATTER_ADD;
+    throw UserError("Unknown scatter merging mode: " + name);
+  }
+
+
+  namespace {
+
+    /// Position of an object in the inputs, as (file index, object index)
+    typedef pair<size_t,size_t> Position;
+
+    /// Treatment imposed on a path when it has to be merged a second time
+    enum Forced { FORCE_NONE, FORCE_PLAIN, FORCE_SCATTER, FORCE_FIRST };
+
+    /// Normalisation treatment of the fillable copies added so far
+    enum Norm { NORM_UNSET, NORM_PLAIN, NORM_SCALED };
+
+
+    /// Running scale-weighted sums of scatter values and squared errors, per point
+    struct ScatterSums {
+      double scalesum = 0;
+      vector<double> vals;
+      vector< map<string, pair<double,double> > > errs2;
+    };
+
+
+    /// Merge state for all the copies of one path seen so far
+    struct Accumulator {
+      unique_ptr<AnalysisObject> ao;    ///< Merge of the (non-vetoed) copies so far
+      unique_ptr<AnalysisObject> first; ///< First copy, kept while every copy so far was vetoed as empty
+      set<string> types;                ///< Types of all the copies
+      string firsttype;                 ///< Type of the first copy
+      Position pos;                     ///< Where the first copy appeared
+      size_t n = 0;                     ///< Number of copies in ao
+      Norm norm = NORM_UNSET;
+      double invnorm = 0;               ///< Sum of scale/ScaledBy over normalised copies
+      double scale = 1;                 ///< Scale of the first copy in ao
+      bool scaledby = false;            ///< Whether the first copy in ao had a non-zero ScaledBy
+      bool userscaled = false;          ///< Whether any copy had a non-unit scale
+      bool redo = false;                ///< Needs a second pass, once all the copies are known about
+      bool zeronorm = false;            ///< ... because of a zero normalisation
+      ScatterSums sums;                 ///< Scatter sums, filled once there are two copies
+    };
+
+    typedef map<string, Accumulator> Accumulators;
+
+
+
+    /// @name Type-dispatched helpers
+    //@{
+
+    bool _isFillable(const string& type) {
+      return type == "Counter" || type == "Histo1D" || type == "Histo2D" || type == "Profile1D" || type == "Profile2D";
+    }
+
+    /// Type of scatter that objects of @a type convert to, or "" if none
+    string _scatterType(const string& type) {
+      if (type == "Counter" || type == "Scatter1D") return "Scatter1D";
+      if (type == "Histo1D" || type == "Profile1D" || type == "Scatter2D") return "Scatter2D";
+      if (type == "Histo2D" || type == "Profile2D" || type == "Scatter3D") return "Scatter3D";
+      return "";
+    }
+
+    double _sumW(const AnalysisObject& ao) {
+      const string type = ao.type();
+      if (type == "Counter") return static_cast<const Counter&>(ao).sumW();
+      if (type == "Histo1D") return static_cast<const Histo1D&>(ao).sumW();
+      if (type == "Histo2D") return static_cast<const Histo2D&>(ao).sumW();
+      if (type == "Profile1D") return static_cast<const Profile1D&>(ao).sumW();
+      if (type == "Profile2D") return static_cast<const Profile2D&>(ao).sumW();
+      throw LogicError("Can't get sumW of a " + type);
+    }
+
+    void _scaleW(AnalysisObject& ao, double scale) {
+      const string type = ao.type();
+      if (type == "Counter") static_cast<Counter&>(ao).scaleW(scale);
+      else if (type == "Histo1D") static_cast<Histo1D&>(ao).scaleW(scale);
+      else if (type == "Histo2D") static_cast<Histo2D&>(ao).scaleW(scale);
+      else if (type == "Profile1D") static_cast<Profile1D&>(ao).scaleW(scale);
+      else if (type == "Profile2D") static_cast<Profile2D&>(ao).scaleW(scale);
+      else throw LogicError("Can't scale the weights of a " + type);
+    }
+
+    void _add(AnalysisObject& ao, const AnalysisObject& other) {
+      const string type = ao.type();
+      if (type == "Counter") static_cast<Counter&>(ao) += static_cast<const Counter&>(other);
+      else if (type == "Histo1D") static_cast<Histo1D&>(ao) += static_cast<const Histo1D&>(other);
+      else if (type == "Histo2D") static_cast<Histo2D&>(ao) += static_cast<const Histo2D&>(other);
+      else if (type == "Profile1D") static_cast<Profile1D&>(ao) += static_cast<const Profile1D&>(other);
+      else if (type == "Profile2D") static_cast<Profile2D&>(ao) += static_cast<const Profile2D&>(other);
+      else throw LogicError("Can't add objects of type " + type);
+    }
+
+    AnalysisObject* _mkScatter(const AnalysisObject& ao) {
+      const string type = ao.type();
+      AnalysisObject* rtn = nullptr;
+      if (type == "Counter") rtn = new Scatter1D(mkScatter(static_cast<const Counter&>(ao)));
+      else if (type == "Histo1D") rtn = new Scatter2D(mkScatter(static_cast<const Histo1D&>(ao)));
+      else if (type == "Histo2D") rtn = new Scatter3D(mkScatter(static_cast<const Histo2D&>(ao)));
+      else if (type == "Profile1D") rtn = new Scatter2D(mkScatter(static_cast<const Profile1D&>(ao)));
+      else if (type == "Profile2D") rtn = new Scatter3D(mkScatter(static_cast<const Profile2D&>(ao)));
+      else if (type == "Scatter1D") rtn = new Scatter1D(static_cast<const Scatter1D&>(ao));
+      else if (type == "Scatter2D") rtn = new Scatter2D(static_cast<const Scatter2D&>(ao));
+      else if (type == "Scatter3D") rtn = new Scatter3D(static_cast<const Scatter3D&>(ao));
+      else throw LogicError("Can't make a scatter from a " + type);
+      // mkScatter copies the source's Type annotation, but the merge dispatches on the new type
+      rtn->setAnnotation("Type", _scatterType(type));
+      return rtn;
+    }
+
+    //@}
+
+
+    /// @name Scatter merging
+    //@{
+
+    MergeOptions::ScatterMode _scatterMode(const string& type, const MergeOptions& opts) {
+      if (opts.stack) return MergeOptions::SCATTER_ADD;
+      if (type == "Scatter1D") return opts.s1dMode;
+      if (type == "Scatter2D") return opts.s2dMode;
+      return opts.s3dMode;
+    }
+
+    template <typename SCATTER>
+    void _fillSums(ScatterSums& sums, SCATTER& s, double scale) {
+      s.variations(); //< make sure any legacy error breakdown is unpacked
+      const size_t dim = s.dim();
+      sums.scalesum = scale;
+      sums.vals.assign(s.numPoints(), 0.0);
+      sums.errs2.assign(s.numPoints(), map<string, pair<double,double> >());
+      for (size_t i = 0; i < s.numPoints(); ++i) {
+        sums.vals[i] = scale * s.point(i).val(dim);
+        for (const auto& e : s.point(i).errMap()) {
+          pair<double,double>& e2 = sums.errs2[i][e.first];
+          e2.first = sqr(scale * e.second.first);
+          e2.second = sqr(scale * e.second.second);
+        }
+      }
+    }
+
+    void _fillSums(ScatterSums& sums, AnalysisObject& ao, double scale) {
+      const string type = ao.type();
+      if (type == "Scatter1D") _fillSums(sums, static_cast<Scatter1D&>(ao), scale);
+      else if (type == "Scatter2D") _fillSums(sums, static_cast<Scatter2D&>(ao), scale);
+      else _fillSums(sums, static_cast<Scatter3D&>(ao), scale);
+    }
+
+    void _addSums(ScatterSums& sums, const ScatterSums& other) {
+      sums.scalesum += other.scalesum;
+      for (size_t i = 0; i < sums.vals.size(); ++i) {
+        sums.vals[i] += other.vals[i];
+        for (const auto& e : other.errs2[i]) {
+          pair<double,double>& e2 = sums.errs2[i][e.first];
+          e2.first += e.second.first;
+          e2.second += e.second.second;
+        }
+      }
+    }
+
+    template <typename SCATTER>
+    void _applySums(SCATTER& s, const ScatterSums& sums, bool mean) {
+      const size_t dim = s.dim();
+      const double norm = mean ? sums.scalesum : 1.0;
+      for (size_t i = 0; i < s.numPoints(); ++i) {
+        s.point(i).setVal(dim, sums.vals[i]/norm);
+        for (const auto& e2 : sums.errs2[i]) {
+          s.point(i).setErrs(dim, sqrt(e2.second.first)/norm, sqrt(e2.second.second)/norm, e2.first);
+        }
+      }
+    }
+
+    void _applySums(AnalysisObject& ao, const ScatterSums& sums, bool mean) {
+      const string type = ao.type();
+      if (type == "Scatter1D") _applySums(static_cast<Scatter1D&>(ao), sums, mean);
+      else if (type == "Scatter2D") _applySums(static_cast<Scatter2D&>(ao), sums, mean);
+      else _applySums(static_cast<Scatter3D&>(ao), sums, mean);
+    }
+
+    size_t _numPoints(const AnalysisObject& ao) {
+      const string type = ao.type();
+      if (type == "Scatter1D") return static_cast<const Scatter1D&>(ao).numPoints();
+      if (type == "Scatter2D") return static_cast<const Scatter2D&>(ao).numPoints();
+      return static_cast<const Scatter3D&>(ao).numPoints();
+    }
+
+    void _combineWith(AnalysisObject& ao, const AnalysisObject& other) {
+      const string type = ao.type();
+      if (type == "Scatter1D") static_cast<Scatter1D&>(ao).combineWith(static_cast<const Scatter1D&>(other));
+      else if (type == "Scatter2D") static_cast<Scatter2D&>(ao).combineWith(static_cast<const Scatter2D&>(other));
+      else static_cast<Scatter3D&>(ao).combineWith(static_cast<const Scatter3D&>(other));
+    }
+
+    //@}
+
+
+    /// @name Accumulation
+    //@{
+
+    /// Make the merge state for a single copy @a ao, scaled by @a scale
+    Accumulator _mkAccumulator(unique_ptr<AnalysisObject> ao, double scale, const Position& pos,
+                               Forced forced, const MergeOptions& opts) {
+      Accumulator one;
+      one.firsttype = ao->type();
+      one.types.insert(one.firsttype);
+      one.pos = pos;
+      one.scale = scale;
+      one.userscaled = (scale != 1.0);
+
+      if (forced == FORCE_FIRST) {
+        one.ao = move(ao);
+        one.n = 1;
+        return one;
+      }
+      if (forced == FORCE_SCATTER) ao.reset(_mkScatter(*ao));
+
+      if (_isFillable(ao->type())) {
+        // Hold back empty objects, to avoid e.g. unnormalised empty copies blocking the normalised merge
+        if (opts.vetoEmpty && _sumW(*ao) == 0) {
+          one.first = move(ao);
+          return one;
+        }
+        const double scaledby = ao->annotation<double>("ScaledBy", 0.0);
+        one.scaledby = (scaledby != 0);
+        one.norm = (ao->hasAnnotation("ScaledBy") && !opts.stack && forced != FORCE_PLAIN) ? NORM_SCALED : NORM_PLAIN;
+        if (one.norm == NORM_SCALED) {
+          if (scaledby == 0) {
+            one.redo = one.zeronorm = true;
+            return one;
+          }
+          one.invnorm = scale / scaledby;
+          _scaleW(*ao, 1.0/scaledby);
+        }
+        _scaleW(*ao, scale);
+      }
+
+      one.ao = move(ao);
+      one.n = 1;
+      return one;
+    }
+
+
+    /// Fold the state @a b into @a a, where all of @a b's copies come after those of @a a
+    void _combine(Accumulator& a, Accumulator& b, Forced forced, const string& path, const MergeOptions& opts) {
+      if (a.types.empty()) {
+        a = move(b);
+        return;
+      }
+      a.types.insert(b.types.begin(), b.types.end());
+      a.userscaled |= b.userscaled;
+      a.zeronorm |= b.zeronorm;
+      if (forced == FORCE_NONE && a.types.size() > 1) a.redo = true;
+      if (a.redo || b.redo) {
+        a.redo = true;
+        a.ao.reset();
+        a.first.reset();
+        a.sums = ScatterSums();
+        return;
+      }
+
+      // Only vetoed copies on one side or the other
+      if (!b.ao) {
+        if (!a.ao && !a.first) a.first = move(b.first);
+        return;
+      }
+      if (!a.ao) {
+        a.ao = move(b.ao);
+        a.n = b.n;
+        a.norm = b.norm;
+        a.invnorm = b.invnorm;
+        a.scale = b.scale;
+        a.scaledby = b.scaledby;
+        a.sums = move(b.sums);
+        a.first.reset();
+        return;
+      }
+      if (forced == FORCE_FIRST) return;
+
+      const string type = a.ao->type();
+      if (_isFillable(type)) {
+        if (a.norm != b.norm) {
+          a.redo = true;
+          a.ao.reset();
+          return;
+        }
+        _add(*a.ao, *b.ao);
+        a.invnorm += b.invnorm;
+
+      } else if (!_scatterType(type).empty()) {
+        const MergeOptions::ScatterMode mode = _scatterMode(type, opts);
+        if (mode == MergeOptions::SCATTER_COMBINE) {
+          _combineWith(*a.ao, *b.ao);
+        } else if (mode == MergeOptions::SCATTER_ASSUME_MEAN || mode == MergeOptions::SCATTER_ADD) {
+          if (_numPoints(*a.ao) != _numPoints(*b.ao))
+            throw UserError("Can't merge copies of " + path + " with different numbers of points");
+          if (a.n == 1) _fillSums(a.sums, *a.ao, a.scale);
+          if (b.n == 1) _fillSums(b.sums, *b.ao, b.scale);
+          _addSums(a.sums, b.sums);
+        }
+      }
+      a.n += b.n;
+    }
+
+
+    /// Turn the merge state into the final merged object
+    AnalysisObject* _finalize(const string& path, Accumulator& acc, const MergeOptions& opts) {
+      if (!acc.ao) return acc.first.release();
+      const string type = acc.ao->type();
+      if (_isFillable(type)) {
+        if (acc.norm == NORM_SCALED) {
+          _scaleW(*acc.ao, 1.0/acc.invnorm);
+        } else if (opts.stack && acc.n == 1 && acc.scaledby && acc.scale != 0) {
+          // A lone copy is still treated as normalised when stacking, which undoes its scaling
+          _scaleW(*acc.ao, 1.0/acc.scale);
+        }
+      } else if (!_scatterType(type).empty()) {
+        const MergeOptions::ScatterMode mode = _scatterMode(type, opts);
+        if (acc.n > 1 && (mode == MergeOptions::SCATTER_ASSUME_MEAN || mode == MergeOptions::SCATTER_ADD)) {
+          cerr << "WARNING: " << type << " " << path << " merge assumes asymptotic statistics and equal run sizes"
+               << (acc.userscaled ? " (+ user scaling)" : "") << endl;
+          _applySums(*acc.ao, acc.sums, mode == MergeOptions::SCATTER_ASSUME_MEAN);
+        }
+      } else if (acc.n > 1) {
+        cerr << "WARNING: Analysis object " << path << " of type " << type << " cannot be merged" << endl;
+      }
+      return acc.ao.release();
+    }
+
+    //@}
+
+
+    /// @name Parallel passes over the inputs
+    //@{
+
+    /// Run each of @a jobs in its own thread, rethrowing the first exception raised
+    void _runAll(const vector< function<void()> >& jobs) {
+      if (jobs.size() == 1) {
+        jobs[0]();
+        return;
+      }
+      vector<exception_ptr> errs(jobs.size());
+      vector<thread> threads;
+      for (size_t i = 0; i < jobs.size(); ++i) {
+        threads.push_back(thread([&jobs, &errs, i]() {
+              try { jobs[i](); } catch (...) { errs[i] = current_exception(); }
+            }));
+      }
+      for (thread& t : threads) t.join();
+      for (const exception_ptr& e : errs) if (e) rethrow_exception(e);
+    }
+
+
+    /// Forced treatment of @a path, or FORCE_NONE
+    Forced _forced(const map<string,Forced>* forced, const string& path) {
+      if (!forced) return FORCE_NONE;
+      const auto it = forced->find(path);
+      return (it != forced->end()) ? it->second : FORCE_NONE;
+    }
+
+
+    /// @brief Stream through inputs [begin, end), folding each object into @a accs
+    ///
+    /// If @a forced is given, only the paths it lists are merged, with the given treatment.
+    void _mergeFiles(Accumulators& accs, const vector< pair<string,double> >& inputs, size_t begin, size_t end,
+                     const map<string,Forced>* forced, const MergeOptions& opts) {
+      for (size_t i = begin; i < end; ++i) {
+        vector<AnalysisObject*> aos;
+        mkReader(inputs[i].first).read(inputs[i].first, aos);
+        vector< unique_ptr<AnalysisObject> > owned(aos.begin(), aos.end());
+        for (size_t j = 0; j < owned.size(); ++j) {
+          const string path = owned[j]->path();
+          if (forced && !forced->count(path)) continue;
+          const Forced f = _forced(forced, path);
+          Accumulator one = _mkAccumulator(move(owned[j]), inputs[i].second, Position(i, j), f, opts);
+          _combine(accs[path], one, f, path, opts);
+        }
+      }
+    }
+
+
+    /// Merge all the inputs: contiguous blocks are streamed in parallel, then tree-reduced
+    Accumulators _mergePass(const vector< pair<string,double> >& inputs, size_t nthreads,
+                            const map<string,Forced>* forced, const MergeOptions& opts) {
+      const size_t nparts = max<size_t>(min(nthreads, inputs.size()), 1);
+      vector<Accumulators> parts(nparts);
+      vector< function<void()> > jobs;
+      for (size_t k = 0; k < nparts; ++k) {
+        const size_t begin = k*inputs.size()/nparts, end = (k+1)*inputs.size()/nparts;
+        jobs.push_back([&, k, begin, end]() { _mergeFiles(parts[k], inputs, begin, end, forced, opts); });
+      }
+      _runAll(jobs);
+
+      // Pairwise reduction, always folding the later block into the earlier one
+      for (size_t step = 1; step < nparts; step *= 2) {
+        jobs.clear();
+        for (size_t k = 0; k + step < nparts; k += 2*step) {
+          jobs.push_back([&, k, step]() {
+              for (auto& pa : parts[k+step]) {
+                _combine(parts[k][pa.first], pa.second, _forced(forced, pa.first), pa.first, opts);
+              }
+              parts[k+step].clear();
+            });
+        }
+        _runAll(jobs);
+      }
+      return move(parts[0]);
+    }
+
+    //@}
+
+  }
+
+
+  vector<AnalysisObject*> merge(const vector< pair<string,double> >& inputs, const MergeOptions& opts) {
+    vector<AnalysisObject*> rtn;
+    if (inputs.empty()) return rtn;
+    const size_t nthreads = (opts.nthreads > 0) ? opts.nthreads : max<size_t>(thread::hardware_concurrency(), 1);
+    Accumulators accs = _mergePass(inputs, nthreads, nullptr, opts);
+
+    // Decide how to treat the paths that couldn't be merged in a single pass
+    map<string,Forced> forced;
+    for (auto& pa : accs) {
+      const string& path = pa.first;
+      Accumulator& acc = pa.second;
+      if (!acc.redo && acc.ao && acc.norm == NORM_SCALED && acc.invnorm == 0) acc.redo = acc.zeronorm = true;
+      if (!acc.redo) continue;
+      if (acc.types.size() > 1) {
+        string msg = "WARNING: cannot merge mismatched analysis object types for path " + path + ": ";
+        Forced f = FORCE_FIRST;
+        if (opts.mismatchToScatter) {
+          set<string> stypes;
+          for (const string& t : acc.types) stypes.insert(_scatterType(t));
+          msg += "converting to " + _scatterType(acc.firsttype) + "s";
+          if (stypes.size() == 1 && !stypes.begin()->empty()) f = FORCE_SCATTER;
+          else msg += "... failed, ";
+        }
+        if (f == FORCE_FIRST) msg += "returning first object";
+        cerr << msg << endl;
+        forced[path] = f;
+      } else {
+        cerr << "WARNING: Abandoning normalized merge of path " << path
+             << (acc.zeronorm ? " because ScaledBy attributes are zero." : " because some but not all inputs have ScaledBy attributes")
+             << endl;
+        forced[path] = FORCE_PLAIN;
+      }
+    }
+    if (!forced.empty()) {
+      Accumulators again = _mergePass(inputs, nthreads, &forced, opts);
+      for (auto& pa : again) accs[pa.first] = move(pa.second);
+    }
+
+    // Finalise the merged objects, in order of first appearance
+    vector< pair<Position, Accumulators::iterator> > order;
+    for (Accumulators::iterator it = accs.begin(); it != accs.end(); ++it) {
+      order.push_back(make_pair(it->second.pos, it));
+    }
+    sort(order.begin(), order.end(),
+         [](const pair<Position, Accumulators::iterator>& a, const pair<Position, Accumulators::iterator>& b) {
+           return a.first < b.first;
+         });
+    for (const auto& o : order) {
+      AnalysisObject* ao = _finalize(o.second->first, o.second->second, opts);
+      if (ao) rtn.push_back(ao);
+    }
+    return rtn;
+  }
+
+
+}
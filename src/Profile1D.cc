@@ -155,13 +155,18 @@ namespace YODA {
   Scatter2D divide(const Profile1D& numer, const Profile1D& denom) {
     Scatter2D rtn;
 
+    std::vector<Point2D> points;
+    points.reserve(numer.numBins());
+    // Axes booked with the same binning share it, making this usually a pointer comparison
+    const bool samebinning = numer.sameBinning(denom);
     for (size_t i = 0; i < numer.numBins(); ++i) {
       const ProfileBin1D& b1 = numer.bin(i);
       const ProfileBin1D& b2 = denom.bin(i);
 
-      /// @todo Create a compatibleBinning function? Or just compare vectors of edges().
-      if (!fuzzyEquals(b1.xMin(), b2.xMin()) || !fuzzyEquals(b1.xMax(), b2.xMax()))
-        throw BinningError("x binnings are not equivalent in " + numer.path() + " / " + denom.path());
+      if (!samebinning) {
+        if (!fuzzyEquals(b1.xMin(), b2.xMin()) || !fuzzyEquals(b1.xMax(), b2.xMax()))
+          throw BinningError("x binnings are not equivalent in " + numer.path() + " / " + denom.path());
+      }
 
       // Assemble the x value and error
       // Use the midpoint of the "bin" for the new central x value, in the absence of better information
@@ -193,8 +198,9 @@ namespace YODA {
       /// @todo check correctness with different signed numerator and denominator.
       //const double eyplus = y * sqrt( sqr(p1.yErrPlus()/p1.y()) + sqr(p2.yErrMinus()/p2.y()) );
       //const double eyminus = y * sqrt( sqr(p1.yErrMinus()/p1.y()) + sqr(p2.yErrPlus()/p2.y()) );
-      rtn.addPoint(x, y, exminus, explus, ey, ey);
+      points.push_back(Point2D(x, y, exminus, explus, ey, ey));
     }
+    rtn.addPoints(points);
 
     assert(rtn.numPoints() == numer.numBins());
     return rtn;
@@ -22,9 +22,9 @@ using namespace std;
 
 namespace YODA {
 
-  /// Singleton creation function
+  /// Creation function for the calling thread's shared instance
   Reader& ReaderAIDA::create() {
-    static ReaderAIDA _instance;
+    static thread_local ReaderAIDA _instance;
     return _instance;
   }
 
@@ -64,6 +64,7 @@ namespace YODA {
         //  }
         //}
 
+        vector<Point2D> points;
         size_t ipt = 0;
         for (const TiXmlNode* dpN = dpsN->FirstChild("dataPoint"); dpN; dpN = dpN->NextSibling("dataPoint")) {
           ipt += 1;
@@ -95,8 +96,9 @@ namespace YODA {
           double xcentre, xerrplus, xerrminus, ycentre, yerrplus, yerrminus;
           xssC >> xcentre; xssP >> xerrplus; xssM >> xerrminus;
           yssC >> ycentre; yssP >> yerrplus; yssM >> yerrminus;
-          dps->addPoint(xcentre, ycentre, xerrminus, xerrplus, yerrminus, yerrplus);
+          points.push_back(Point2D(xcentre, ycentre, xerrminus, xerrplus, yerrminus, yerrplus));
         }
+        dps->addPoints(points);
         aos.push_back(dps);
 
       }
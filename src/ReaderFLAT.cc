@@ -18,9 +18,9 @@ using namespace std;
 
 namespace YODA {
 
-  /// Singleton creation function
+  /// Creation function for the calling thread's shared instance
   Reader& ReaderFLAT::create() {
-    static ReaderFLAT _instance;
+    static thread_local ReaderFLAT _instance;
     return _instance;
   }
 
@@ -40,6 +40,9 @@ namespace YODA {
     Scatter1D* s1curr = NULL;
     Scatter2D* s2curr = NULL;
     Scatter3D* s3curr = NULL;
+    vector<Point1D> pt1scurr; //< Current Point1Ds container
+    vector<Point2D> pt2scurr; //< Current Point2Ds container
+    vector<Point3D> pt3scurr; //< Current Point3Ds container
 
     // Loop over all lines of the input file
     while (Utils::getline(stream, s)) {
@@ -100,6 +103,10 @@ namespace YODA {
         // Clear/reset context and register AO if END line is found
         /// @todo Throw error if mismatch between BEGIN (context) and END types
         if (s.find("END ") != string::npos) {
+          // Add the accumulated points in one go, so they only get sorted once
+          if (s1curr) { s1curr->addPoints(pt1scurr); pt1scurr.clear(); }
+          if (s2curr) { s2curr->addPoints(pt2scurr); pt2scurr.clear(); }
+          if (s3curr) { s3curr->addPoints(pt3scurr); pt3scurr.clear(); }
           aos.push_back(aocurr);
           context = NONE;
           aocurr = NULL; s1curr = NULL; s2curr = NULL; s3curr = NULL;
@@ -123,7 +130,7 @@ namespace YODA {
           {
             double x(0), exm(0), exp(0);
             iss >> x >> exm >> exp;
-            s1curr->addPoint(Point1D(x, exm, exp));
+            pt1scurr.push_back(Point1D(x, exm, exp));
           }
           break;
 
@@ -133,7 +140,7 @@ namespace YODA {
             iss >> xlow >> xhigh >> y >> eym >> eyp;
             const double x = (xlow + xhigh)/2.0;
             const double ex = (xhigh - xlow)/2.0;
-            s2curr->addPoint(Point2D(x, y, ex, ex, eym, eyp));
+            pt2scurr.push_back(Point2D(x, y, ex, ex, eym, eyp));
           }
           break;
 
@@ -145,7 +152,7 @@ namespace YODA {
             const double ex = (xhigh - xlow)/2.0;
             const double y = (ylow + yhigh)/2.0;
             const double ey = (yhigh - ylow)/2.0;
-            s3curr->addPoint(Point3D(x, y, z, ex, ex, ey, ey, ezm, ezp));
+            pt3scurr.push_back(Point3D(x, y, z, ex, ex, ey, ey, ezm, ezp));
           }
           break;
 
@@ -7,6 +7,7 @@
 #include "YODA/Utils/StringUtils.h"
 #include "YODA/Utils/getline.h"
 #include "YODA/Exceptions.h"
+#include "YODA/Stats.h"
 #include "YODA/Config/DummyConfig.h"
 
 #include "YODA/Counter.h"
@@ -29,14 +30,16 @@
 #endif
 
 #include <iostream>
+#include <fstream>
 #include <cstring>
+#include <cctype>
 using namespace std;
 
 namespace YODA {
 
-  /// Singleton creation function
+  /// Creation function for the calling thread's shared instance
   Reader& ReaderYODA::create() {
-    static ReaderYODA _instance;
+    static thread_local ReaderYODA _instance;
     return _instance;
   }
 
@@ -71,6 +74,20 @@ namespace YODA {
       // Allow use of operator>> in a while loop
       operator bool() const { return !_error; }
 
+      // Tokenize a double which may be given as a "-" placeholder, returning false for the latter
+      bool getOptional(double& x) {
+        _get(x);
+        if (_new_next != _next) {
+          _next = _new_next;
+          return true;
+        }
+        while (std::isspace(*_next)) _next += 1;
+        if (*_next == '-') _next += 1;
+        else _error = true;
+        _new_next = _next;
+        return false;
+      }
+
     private:
       void _get(double& x) { x = std::strtod(_next, &_new_next); }
       void _get(float& x) { x = std::strtof(_next, &_new_next); }
@@ -90,10 +107,26 @@ namespace YODA {
       bool _error;
     };
 
+
+    /// Read the error-breakdown columns of a scatter point line, with "-" marking missing sources
+    void _readVariations(aistringstream& aiss, Point& pt,
+                         const Point::VariationTablePtr& vartable, const vector<size_t>& varids) {
+      if (varids.empty()) return;
+      pt.setVariationTable(vartable);
+      for (size_t id : varids) {
+        double em(0), ep(0);
+        const bool hasm = aiss.getOptional(em);
+        const bool hasp = aiss.getOptional(ep);
+        if (!aiss) throw ReadError("Unexpected error-breakdown column format in YODA scatter point");
+        if (hasm || hasp) pt.setVariationErrs(id, std::make_pair(em, ep));
+      }
+    }
+
   }
 
 
   void ReaderYODA::read(istream& stream_, vector<AnalysisObject*>& aos) {
+    YODA_STATS_TIME(READER_NS);
 
     #ifdef HAVE_LIBZ
     // NB. zstr auto-detects if file is deflated or plain-text
@@ -122,6 +155,8 @@ namespace YODA {
     vector<Point1D> pt1scurr; //< Current Point1Ds container
     vector<Point2D> pt2scurr; //< Current Point2Ds container
     vector<Point3D> pt3scurr; //< Current Point3Ds container
+    Point::VariationTablePtr vartablecurr; //< Variations named in the current scatter's column header
+    vector<size_t> varidscurr; //< IDs of the current scatter's error-breakdown columns in vartablecurr
     Counter* cncurr = NULL;
     Histo1D* h1curr = NULL;
     Histo2D* h2curr = NULL;
@@ -130,7 +165,6 @@ namespace YODA {
     Scatter1D* s1curr = NULL;
     Scatter2D* s2curr = NULL;
     Scatter3D* s3curr = NULL;
-    //std::vector<std::string> variationscurr;
     string annscurr;
 
     // Loop over all lines of the input file
@@ -140,6 +174,7 @@ namespace YODA {
     //int nfmt = 1;
     while (Utils::getline(stream, s)) {
       nline += 1;
+      YODA_STATS_COUNT(READER_LINES);
 
 
       // CLEAN LINES IF NOT IN ANNOTATION MODE
@@ -150,6 +185,22 @@ namespace YODA {
         // Ignore blank lines
         if (s.empty()) continue;
 
+        // Scatter column headers name any error-breakdown variations, stored as extra
+        // "err-(name)" / "err+(name)" column pairs after the nominal errors
+        if ((context == SCATTER1D || context == SCATTER2D || context == SCATTER3D) && s.find("# xval") == 0) {
+          vartablecurr = std::make_shared<Utils::VariationTable>();
+          varidscurr.clear();
+          const string errminus = (context == SCATTER1D) ? "xerr-(" : (context == SCATTER2D) ? "yerr-(" : "zerr-(";
+          istringstream iss(s.substr(1)); string col;
+          while (std::getline(iss, col, '\t')) {
+            const string label = Utils::trim(col);
+            if (label.find(errminus) != 0 || label.size() <= errminus.size() || label.back() != ')') continue;
+            const string varname = label.substr(errminus.size(), label.size() - errminus.size() - 1);
+            varidscurr.push_back(vartablecurr->intern(varname));
+          }
+          continue;
+        }
+
         // Ignore comments (whole-line only, without indent, and still allowed for compatibility on BEGIN/END lines)
         if (s.find("#") == 0 && s.find("BEGIN") == string::npos && s.find("END") == string::npos) continue;
       }
@@ -244,46 +295,51 @@ namespace YODA {
         // Clear/reset context and register AO
         /// @todo Throw error if mismatch between BEGIN (context) and END types
         if (s.find("END ") != string::npos) { ///< @todo require pos = 0 from fmt=V2
-          switch (context) {
-          case COUNTER:
-            break;
-          case HISTO1D:
-            h1curr->addBins(h1binscurr);
-            h1binscurr.clear();
-            break;
-          case HISTO2D:
-            h2curr->addBins(h2binscurr);
-            h2binscurr.clear();
-            break;
-          case PROFILE1D:
-            p1curr->addBins(p1binscurr);
-            p1binscurr.clear();
-            break;
-          case PROFILE2D:
-            p2curr->addBins(p2binscurr);
-            p2binscurr.clear();
-            break;
-          case SCATTER1D:
-            for (auto &p : pt1scurr)  { p.setParentAO(s1curr); }
-            s1curr->addPoints(pt1scurr);
-            pt1scurr.clear();
-            break;
-          case SCATTER2D:
-            for (auto &p : pt2scurr)  { p.setParentAO(s2curr); }
-            s2curr->addPoints(pt2scurr);
-            pt2scurr.clear();
-            break;
-          case SCATTER3D:
-            for (auto &p : pt3scurr)  { p.setParentAO(s3curr); }
-            s3curr->addPoints(pt3scurr);
-            pt3scurr.clear();
-            break;
-          case NONE:
-            break;
+          YODA_STATS_COUNT(READER_OBJECTS);
+          { // Add the bins or points
+            YODA_STATS_TIME(READER_BUILD_NS);
+            switch (context) {
+            case COUNTER:
+              break;
+            case HISTO1D:
+              h1curr->addBins(h1binscurr);
+              h1binscurr.clear();
+              break;
+            case HISTO2D:
+              h2curr->addBins(h2binscurr);
+              h2binscurr.clear();
+              break;
+            case PROFILE1D:
+              p1curr->addBins(p1binscurr);
+              p1binscurr.clear();
+              break;
+            case PROFILE2D:
+              p2curr->addBins(p2binscurr);
+              p2binscurr.clear();
+              break;
+            case SCATTER1D:
+              for (auto &p : pt1scurr)  { p.setParentAO(s1curr); }
+              s1curr->addPoints(pt1scurr);
+              pt1scurr.clear();
+              break;
+            case SCATTER2D:
+              for (auto &p : pt2scurr)  { p.setParentAO(s2curr); }
+              s2curr->addPoints(pt2scurr);
+              pt2scurr.clear();
+              break;
+            case SCATTER3D:
+              for (auto &p : pt3scurr)  { p.setParentAO(s3curr); }
+              s3curr->addPoints(pt3scurr);
+              pt3scurr.clear();
+              break;
+            case NONE:
+              break;
+            }
           }
 
           // Set all annotations
           try {
+            YODA_STATS_TIME(READER_YAML_NS);
             YAML::Node anns = YAML::Load(annscurr);
             // for (YAML::const_iterator it = anns.begin(); it != anns.end(); ++it) {
             for (const auto& it : anns) {
@@ -292,7 +348,8 @@ namespace YODA {
               YAML::Emitter em;
               em << YAML::Flow << it.second; //< use single-line formatting, for lists & maps
               const string val = em.c_str();
-             // if (!(key.find("ErrorBreakdown") != string::npos)) 
+              // Error-breakdown columns, if present, supersede an ErrorBreakdown annotation
+              if (!varidscurr.empty() && key == "ErrorBreakdown") continue;
               aocurr->setAnnotation(key, val);
             }
           } catch (...) {
@@ -302,7 +359,8 @@ namespace YODA {
             throw ReadError(err);
           }
           annscurr.clear();
-          //variationscurr.clear();
+          vartablecurr.reset();
+          varidscurr.clear();
           in_anns = false;
 
           // Put this AO in the completed stack
@@ -476,16 +534,8 @@ namespace YODA {
             aiss >> x >> exm >> exp;
             // set nominal point
             Point1D thispoint=Point1D(x, exm, exp);
-            // check if we stored variations of this point
-            //if (variationscurr.size()>0){
-            //  // for each variation, store the alt errors.
-            //  // start at 1 since we have already filled nominal !
-            //  for (unsigned int ivar=1; ivar<variationscurr.size(); ivar++){
-            //   std::string thisvariation=variationscurr[ivar];
-            //    aiss >> exm >> exp;
-            //    thispoint.setXErrs(exm,exp,thisvariation);
-            //  }
-            //}
+            // then any error-breakdown variations, named in the column header
+            _readVariations(aiss, thispoint, vartablecurr, varidscurr);
             pt1scurr.push_back(thispoint);
           }
           break;
@@ -496,9 +546,8 @@ namespace YODA {
             aiss >> x >> exm >> exp >> y >> eym >> eyp;
             // set nominal point
             Point2D thispoint=Point2D(x, y, exm, exp, eym, eyp);
-            // check if we stored variations of this point
-            // for each variation, store the alt errors.
-            // start at 1 since we have already filled nominal !
+            // then any error-breakdown variations, named in the column header
+            _readVariations(aiss, thispoint, vartablecurr, varidscurr);
             pt2scurr.push_back(thispoint);
           }
           break;
@@ -509,6 +558,8 @@ namespace YODA {
             aiss >> x >> exm >> exp >> y >> eym >> eyp >> z >> ezm >> ezp;
             // set nominal point
             Point3D thispoint=Point3D(x, y, z, exm, exp, eym, eyp, ezm, ezp);
+            // then any error-breakdown variations, named in the column header
+            _readVariations(aiss, thispoint, vartablecurr, varidscurr);
             pt3scurr.push_back(thispoint);
           }
           break;
@@ -524,5 +575,217 @@ namespace YODA {
         }
      }
   }
-}
 
+
+  namespace {
+
+    /// Chunked line splitter which tracks the byte offset of each line, for scan()
+    class LineScanner {
+    public:
+
+      LineScanner(istream& is) : _is(is), _buf(1 << 16), _pos(0), _end(0), _base(0), _eof(false) { }
+
+      /// Get the next line as [b, e) without its terminator, and the offset of its start
+      bool next(const char*& b, const char*& e, size_t& start) {
+        for (;;) {
+          const char* p = &_buf[0];
+          const char* nl = static_cast<const char*>(memchr(p + _pos, '\n', _end - _pos));
+          if (nl != nullptr || (_eof && _pos < _end)) {
+            b = p + _pos;
+            e = (nl != nullptr) ? nl : p + _end;
+            start = _base + _pos;
+            _pos = (nl != nullptr ? nl + 1 : e) - p;
+            if (e > b && e[-1] == '\r') --e;
+            return true;
+          }
+          if (_eof) return false;
+          _fill();
+        }
+      }
+
+      /// Offset of the start of the next line
+      size_t offset() const { return _base + _pos; }
+
+    private:
+
+      void _fill() {
+        // Keep any partial line, moved to the front, and grow the buffer if it holds nothing else
+        if (_pos > 0) {
+          memmove(&_buf[0], &_buf[_pos], _end - _pos);
+          _base += _pos;
+          _end -= _pos;
+          _pos = 0;
+        }
+        if (_end == _buf.size()) _buf.resize(2*_buf.size());
+        _is.read(&_buf[_end], _buf.size() - _end);
+        const size_t n = _is.gcount();
+        _end += n;
+        if (n == 0) _eof = true;
+      }
+
+      istream& _is;
+      vector<char> _buf;
+      size_t _pos, _end, _base;
+      bool _eof;
+    };
+
+
+    inline void _trim(const char*& b, const char*& e) {
+      while (b != e && isspace((unsigned char) *b)) ++b;
+      while (e != b && isspace((unsigned char) e[-1])) --e;
+    }
+
+    /// Does [b, e) contain @a word?
+    bool _contains(const char* b, const char* e, const char* word) {
+      const size_t n = strlen(word);
+      while (size_t(e - b) >= n) {
+        const char* p = static_cast<const char*>(memchr(b, word[0], e - b - n + 1));
+        if (p == nullptr) return false;
+        if (memcmp(p, word, n) == 0) return true;
+        b = p + 1;
+      }
+      return false;
+    }
+
+    /// AnalysisObject type name for a BEGIN line's context, e.g. Histo1D for YODA_HISTO1D_V2
+    string _scanType(const string& ctxstr) {
+      static const char* types[] = { "Counter", "Scatter1D", "Scatter2D", "Scatter3D",
+                                     "Histo1D", "Histo2D", "Profile1D", "Profile2D" };
+      for (const char* t : types)
+        if (Utils::startswith(ctxstr, "YODA_" + Utils::toUpper(t))) return t;
+      throw ReadError("Unknown object type in YODA format scan: '" + ctxstr + "'");
+    }
+
+    /// Pick out any Path or Type annotation from an annotation line, which override the BEGIN line
+    void _scanAnnotation(const char* b, const char* e, bool fmt1, ReaderYODA::ScanRecord& rec) {
+      _trim(b, e);
+      // Version 1 annotations are key=value or key: value, later ones are YAML
+      const char* sep = fmt1 ? static_cast<const char*>(memchr(b, '=', e - b)) : nullptr;
+      if (sep == nullptr) sep = static_cast<const char*>(memchr(b, ':', e - b));
+      if (sep == nullptr) return;
+      const char *kb = b, *ke = sep, *vb = sep + 1, *ve = e;
+      _trim(kb, ke);
+      _trim(vb, ve);
+      if (ve - vb >= 2 && (*vb == '"' || *vb == '\'') && ve[-1] == *vb) { ++vb; --ve; }
+      const string key(kb, ke);
+      if (key == "Path") rec.path.assign(vb, ve);
+      else if (key == "Type") rec.type.assign(vb, ve);
+    }
+
+  }
+
+
+  vector<ReaderYODA::ScanRecord> ReaderYODA::scan(istream& stream_, bool withTotals) {
+
+    #ifdef HAVE_LIBZ
+    // NB. zstr auto-detects if file is deflated or plain-text
+    zstr::istream stream(stream_);
+    #else
+    istream& stream = stream_;
+    #endif
+
+    // Follows the block structure of the read() parser, but only interprets BEGIN, END and annotation lines
+    vector<ScanRecord> rtn;
+    LineScanner lines(stream);
+    const char *b, *e;
+    size_t start, nline = 0;
+    ScanRecord rec;
+    bool in_block = false, in_anns = false, fmt1 = true, counter = false;
+    while (lines.next(b, e, start)) {
+      nline += 1;
+      if (in_block) rec.numLines += 1;
+
+      // Skip blank and comment lines, except in version 2+ annotations
+      if (!in_anns) {
+        _trim(b, e);
+        if (b == e) continue;
+        if (*b == '#' && !_contains(b, e, "BEGIN") && !_contains(b, e, "END")) continue;
+      }
+
+      // Start a new block
+      if (!in_block) {
+        if (!_contains(b, e, "BEGIN ")) {
+          stringstream ss;
+          ss << "Unexpected line in YODA format scan when BEGIN expected: '" << string(b, e) << "' on line " << nline;
+          throw ReadError(ss.str());
+        }
+        while (b != e && *b == '#') ++b;
+        istringstream iss(string(b, e));
+        string begin, ctxstr;
+        iss >> begin >> ctxstr;
+        if (begin != "BEGIN" || ctxstr.empty()) {
+          stringstream ss;
+          ss << "Unexpected BEGIN line structure in YODA format scan: '" << string(b, e) << "' on line " << nline;
+          throw ReadError(ss.str());
+        }
+        rec = ScanRecord();
+        iss >> rec.path;
+        rec.type = _scanType(ctxstr);
+        rec.begin = start;
+        rec.numLines = 1;
+        const size_t vpos = ctxstr.find_last_of("V");
+        fmt1 = (vpos == string::npos || ctxstr.substr(vpos+1) == "1");
+        in_anns = !fmt1;
+        counter = (rec.type == "Counter");
+        in_block = true;
+        continue;
+      }
+
+      if (_contains(b, e, "BEGIN ")) {
+        stringstream ss;
+        ss << "Unexpected BEGIN line in YODA format scan before ending current BEGIN..END block, on line " << nline;
+        throw ReadError(ss.str());
+      }
+
+      // Finish the current block
+      if (_contains(b, e, "END ")) {
+        rec.end = lines.offset();
+        rtn.push_back(rec);
+        in_block = in_anns = false;
+        continue;
+      }
+
+      // Annotations
+      if (in_anns) {
+        if (e - b == 3 && memcmp(b, "---", 3) == 0) in_anns = false;
+        else _scanAnnotation(b, e, false, rec);
+        continue;
+      }
+      if (fmt1 && (memchr(b, '=', e - b) != nullptr || memchr(b, ':', e - b) != nullptr)) {
+        _scanAnnotation(b, e, true, rec);
+        continue;
+      }
+
+      // Data rows: only the leading label of the total and outflow rows is looked at
+      rec.numDataLines += 1;
+      if (counter) {
+        if (withTotals) rec.total.assign(b, e);
+        continue;
+      }
+      if (!isalpha((unsigned char) *b)) {
+        rec.numBins += 1;
+        continue;
+      }
+      const char* lend = b;
+      while (lend != e && !isspace((unsigned char) *lend)) ++lend;
+      const string label(b, lend);
+      if (label == "Total") {
+        if (withTotals) rec.total.assign(b, e);
+      } else if (label != "Underflow" && label != "Overflow" && label != "Outflow") {
+        rec.numBins += 1;
+      }
+    }
+
+    return rtn;
+  }
+
+
+  vector<ReaderYODA::ScanRecord> ReaderYODA::scan(const string& filename, bool withTotals) {
+    if (filename == "-") return scan(cin, withTotals);
+    ifstream instream(filename.c_str(), ios::binary);
+    if (!instream) throw ReadError("Couldn't open file " + filename + " for scanning");
+    return scan(instream, withTotals);
+  }
+
+
+}
@@ -0,0 +1,50 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Sampler.h"
+
+using namespace std;
+
+namespace YODA {
+
+
+  namespace {
+
+    template <typename BIN>
+    vector<double> _binWeights(const vector<BIN>& bins) {
+      vector<double> rtn;
+      rtn.reserve(bins.size());
+      double sumw = 0;
+      for (const BIN& b : bins) {
+        if (b.sumW() < 0) throw WeightError("Attempted to sample a histogram with a negative bin");
+        rtn.push_back(b.sumW());
+        sumw += b.sumW();
+      }
+      if (sumw == 0) throw WeightError("Attempted to sample a histogram with null area");
+      return rtn;
+    }
+
+  }
+
+
+  Histo1DSampler::Histo1DSampler(const Histo1D& h, uint64_t seed)
+    : _table(_binWeights(h.bins())), _rng(seed)
+  {
+    _edges.reserve(h.numBins());
+    for (const HistoBin1D& b : h.bins())
+      _edges.push_back(Edges{b.xMin(), b.xWidth()});
+  }
+
+
+  Histo2DSampler::Histo2DSampler(const Histo2D& h, uint64_t seed)
+    : _table(_binWeights(h.bins())), _rng(seed)
+  {
+    _edges.reserve(h.numBins());
+    for (const HistoBin2D& b : h.bins())
+      _edges.push_back(Edges{b.xMin(), b.xWidth(), b.yMin(), b.yWidth()});
+  }
+
+
+}
@@ -44,16 +44,23 @@ namespace YODA {
   }
   
   const std::vector<std::string> Scatter1D::variations() const  {
-    std::vector<std::string> vecvariations;
-    for (auto &point : this->_points){
-      for (auto &it : point.errMap()){
-        //if the variation is not already in the vector, add it !
-        if (std::find(vecvariations.begin(), vecvariations.end(), it.first) == vecvariations.end()){
-          vecvariations.push_back(it.first);
-        }
+    // Make sure any ErrorBreakdown annotation has been unpacked into the points,
+    // and that points inserted directly into the collection share our ID table
+    Scatter1D* self = const_cast<Scatter1D*>(this);
+    self->parseVariations();
+    for (Point1D& point : self->_points) self->_adopt(point);
+    // Flag the variation IDs that are actually set on at least one point
+    std::vector<bool> used(_vartable->size(), false);
+    for (const Point1D& point : _points) {
+      for (size_t id = 0; id < point.numVariationSlots(); ++id) {
+        if (point.hasVariation(id)) used[id] = true;
       }
     }
-    return vecvariations;
+    std::vector<std::string> vecVariations;
+    for (size_t id = 0; id < used.size(); ++id) {
+      if (used[id]) vecVariations.push_back(_vartable->name(id));
+    }
+    return vecVariations;
   }
   
 }
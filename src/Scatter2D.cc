@@ -16,6 +16,8 @@ namespace YODA {
     for (const std::string& a : h.annotations()) rtn.setAnnotation(a, h.annotation(a));
     rtn.setAnnotation("Type", h.type()); // might override the copied ones
 
+    std::vector<Point2D> points;
+    points.reserve(h.numBins());
     for (const HistoBin1D& b : h.bins()) {
       const double x = usefocus ? b.xFocus() : b.xMid();
       const double ex_m = x - b.xMin();
@@ -33,8 +35,9 @@ namespace YODA {
       // Attach the point to its parent
       Point2D pt(x, y, ex_m, ex_p, ey, ey);
       pt.setParentAO(&rtn);
-      rtn.addPoint(pt);
+      points.push_back(pt);
     }
+    rtn.addPoints(points);
 
     assert(h.numBins() == rtn.numPoints());
     return rtn;
@@ -47,6 +50,8 @@ namespace YODA {
     for (const std::string& a : p.annotations())
       rtn.setAnnotation(a, p.annotation(a));
     rtn.setAnnotation("Type", p.type());
+    std::vector<Point2D> points;
+    points.reserve(p.numBins());
     for (const ProfileBin1D& b : p.bins()) {
       const double x = usefocus ? b.xFocus() : b.xMid();
       const double ex_m = x - b.xMin();
@@ -68,8 +73,9 @@ namespace YODA {
       //const Point2D pt(x, y, ex_m, ex_p, ey, ey);
       Point2D pt(x, y, ex_m, ex_p, ey, ey);
       pt.setParentAO(&rtn);
-      rtn.addPoint(pt);
+      points.push_back(pt);
     }
+    rtn.addPoints(points);
     assert(p.numBins() == rtn.numPoints());
     return rtn;
   }
@@ -97,68 +103,80 @@ namespace YODA {
   }
 
   const std::vector<std::string> Scatter2D::variations() const  {
-    std::vector<std::string> vecVariations;
-    for (auto &point : this->_points){
-      for (auto &it : point.errMap()){
-        //if the variation is not already in the vector, add it !
-        if (std::find(vecVariations.begin(), vecVariations.end(), it.first) == vecVariations.end()){
-          vecVariations.push_back(it.first);
-        }
+    // Make sure any ErrorBreakdown annotation has been unpacked into the points,
+    // and that points inserted directly into the collection share our ID table
+    Scatter2D* self = const_cast<Scatter2D*>(this);
+    self->parseVariations();
+    for (Point2D& point : self->_points) self->_adopt(point);
+    // Flag the variation IDs that are actually set on at least one point
+    std::vector<bool> used(_vartable->size(), false);
+    for (const Point2D& point : _points) {
+      for (size_t id = 0; id < point.numVariationSlots(); ++id) {
+        if (point.hasVariation(id)) used[id] = true;
       }
     }
+    std::vector<std::string> vecVariations;
+    for (size_t id = 0; id < used.size(); ++id) {
+      if (used[id]) vecVariations.push_back(_vartable->name(id));
+    }
     return vecVariations;
   }
 
 
-  std::vector<std::vector<double> > Scatter2D::covarianceMatrix( bool ignoreOffDiagonalTerms)   {
-    int nPoints= this->numPoints();
-    //double covM[nPoints][nPoints] ={};
-    std::vector<std::vector<double> > covM;
-
-
-    // initialose cov matrix to be the right shape!
-    for (int i=0; i<nPoints ; i++) {
-      std::vector< double> row;
-      row.resize(nPoints);
-      covM.push_back(row);
-    }
+  CovarianceSplit Scatter2D::covariance(bool ignoreOffDiagonalTerms, size_t nthreads) const {
+    const size_t nPoints = numPoints();
+    const std::vector<std::string> vars = variations();
+    CovarianceSplit rtn(nPoints);
 
     // case where only have nominal, ie total uncertainty, labelled "" (empty string)
-    if (this->variations().size()==1) {
-      for (int i=0; i<nPoints ; i++) {
-        covM[i][i]= pow(((this->_points[i].yErrs().first+this->_points[i].yErrs().second)/2),2);
-        if (covM[i][i]==0 )  covM[i][i]=1;
+    if (vars.size() == 1) {
+      for (size_t i = 0; i < nPoints; ++i) {
+        double& c = rtn.uncorrelated(i,i);
+        c = pow((_points[i].yErrs().first + _points[i].yErrs().second)/2, 2);
+        if (c == 0) c = 1;
       }
-      return covM;
+      rtn.total += rtn.uncorrelated;
+      return rtn;
     }
-    //more interesting case where we actually have some uncertainty breakdown!
-    auto  systList= this->variations();
-    for (auto sname : systList){
-      if (sname.length()==0) continue;
-      std::vector< double> systErrs;
-      systErrs.resize(nPoints);
-      for (int i=0; i<nPoints ; i++) {
-        auto point = this->_points[i];
-        try {
-          auto variations=point.errMap().at(sname);
-          systErrs[i]=(fabs(variations.first)+fabs(variations.second))*0.5 ;//up/dn are symmetrized since this method can't handle asymmetric errors
-        } catch (const std::exception e) { // Missing bin.
-          systErrs[i]=0.0;
+
+    // More interesting case where we actually have some uncertainty breakdown!
+    // Fill the [variation][point] error arrays once, with up/dn symmetrised since
+    // this method can't handle asymmetric errors, then do a single update for each part
+    std::vector<double> corrErrs, uncorErrs;
+    size_t nCorr = 0, nUncor = 0;
+    std::vector<double> systErrs(nPoints);
+    for (size_t ivar = 1; ivar < _vartable->size(); ++ivar) {
+      bool found = false;
+      for (size_t i = 0; i < nPoints; ++i) {
+        const Point2D& point = _points[i];
+        if (point.hasVariation(ivar)) {
+          const std::pair<double,double>& errs = point.variationErrs(ivar);
+          systErrs[i] = (fabs(errs.first) + fabs(errs.second))*0.5;
+          found = true;
+        } else { // Missing bin.
+          systErrs[i] = 0.0;
         }
       }
-      if (ignoreOffDiagonalTerms ||  sname.find("stat") != std::string::npos ||  sname.find("uncor") != std::string::npos){
-        for (int i=0; i<nPoints ; i++) {
-          covM[i][i] += systErrs[i]*systErrs[i]; // just the diagonal, bins are considered uncorrelated
-        }
-      }else{
-        for (int i=0; i<nPoints ; i++) {
-          for (int j=0; j<nPoints ; j++) {
-            covM[i][j] += systErrs[i]*systErrs[j];
-          }
-        }
+      if (!found) continue;
+      const std::string& sname = _vartable->name(ivar);
+      if (ignoreOffDiagonalTerms || sname.find("stat") != std::string::npos || sname.find("uncor") != std::string::npos) {
+        uncorErrs.insert(uncorErrs.end(), systErrs.begin(), systErrs.end());
+        nUncor += 1;
+      } else {
+        corrErrs.insert(corrErrs.end(), systErrs.begin(), systErrs.end());
+        nCorr += 1;
       }
     }
-    return covM;
+    rtn.correlated.addOuterProducts(corrErrs, nCorr, nthreads);
+    rtn.uncorrelated.addDiagonal(uncorErrs, nUncor);
+    rtn.total += rtn.correlated;
+    rtn.total += rtn.uncorrelated;
+    return rtn;
+  }
+
+
+  std::vector<std::vector<double> > Scatter2D::covarianceMatrix(bool ignoreOffDiagonalTerms) const {
+    return covariance(ignoreOffDiagonalTerms).total.asVectors();
   }
 
 }
@@ -16,6 +16,8 @@ namespace YODA {
     for (const std::string& a : h.annotations()) rtn.setAnnotation(a, h.annotation(a));
     rtn.setAnnotation("Type", h.type());
 
+    std::vector<Point3D> points;
+    points.reserve(h.numBins());
     for (size_t i = 0; i < h.numBins(); ++i) {
       const HistoBin2D& b = h.bin(i);
 
@@ -57,8 +59,9 @@ namespace YODA {
 
       Point3D pt(x, y, z, exminus, explus, eyminus, eyplus, ez, ez);
       pt.setParentAO(&rtn);
-      rtn.addPoint(pt);
+      points.push_back(pt);
     }
+    rtn.addPoints(points);
 
     assert(h.numBins() == rtn.numPoints());
     return rtn;
@@ -70,6 +73,8 @@ namespace YODA {
     for (const std::string& a : h.annotations())
       rtn.setAnnotation(a, h.annotation(a));
     rtn.setAnnotation("Type", h.type());
+    std::vector<Point3D> points;
+    points.reserve(h.numBins());
     for (size_t i = 0; i < h.numBins(); ++i) {
       const ProfileBin2D& b = h.bin(i);
 
@@ -113,8 +118,9 @@ namespace YODA {
         ez = std::numeric_limits<double>::quiet_NaN();
       }
 
-      rtn.addPoint(x, y, z, exminus, explus, eyminus, eyplus, ez, ez);
+      points.push_back(Point3D(x, y, z, exminus, explus, eyminus, eyplus, ez, ez));
     }
+    rtn.addPoints(points);
 
     return rtn;
   }
@@ -141,16 +147,23 @@ namespace YODA {
 
 
   const std::vector<std::string> Scatter3D::variations() const  {
-    std::vector<std::string> vecvariations;
-    for (auto &point : this->_points){
-      for (auto &it : point.errMap()){
-        //if the variation is not already in the vector, add it !
-        if (std::find(vecvariations.begin(), vecvariations.end(), it.first) == vecvariations.end()){
-          vecvariations.push_back(it.first);
-        }
+    // Make sure any ErrorBreakdown annotation has been unpacked into the points,
+    // and that points inserted directly into the collection share our ID table
+    Scatter3D* self = const_cast<Scatter3D*>(this);
+    self->parseVariations();
+    for (Point3D& point : self->_points) self->_adopt(point);
+    // Flag the variation IDs that are actually set on at least one point
+    std::vector<bool> used(_vartable->size(), false);
+    for (const Point3D& point : _points) {
+      for (size_t id = 0; id < point.numVariationSlots(); ++id) {
+        if (point.hasVariation(id)) used[id] = true;
       }
     }
-    return vecvariations;
+    std::vector<std::string> vecVariations;
+    for (size_t id = 0; id < used.size(); ++id) {
+      if (used[id]) vecVariations.push_back(_vartable->name(id));
+    }
+    return vecVariations;
   }
 
 }
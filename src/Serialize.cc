@@ -0,0 +1,330 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Serialize.h"
+#include "YODA/Counter.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Profile2D.h"
+#include "YODA/Scatter1D.h"
+#include "YODA/Scatter2D.h"
+#include "YODA/Scatter3D.h"
+#include "YODA/Exceptions.h"
+#include <cstring>
+#include <cstdint>
+#include <memory>
+using namespace std;
+
+namespace YODA {
+
+
+  namespace {
+
+    /// Leading word of every encoding, which also catches byte-order mismatches
+    const uint32_t MAGIC = 0x59424e31; //< "YBN1"
+
+    /// Object type codes
+    enum TypeCode : uint32_t {
+      COUNTER = 1, HISTO1D, HISTO2D, PROFILE1D, PROFILE2D, SCATTER1D, SCATTER2D, SCATTER3D
+    };
+
+
+    /// Append-only binary buffer
+    struct Encoder {
+      string buf;
+
+      template <typename T>
+      void put(const T& x) {
+        buf.append(reinterpret_cast<const char*>(&x), sizeof(T));
+      }
+
+      void putDoubles(const double* xs, size_t n) {
+        buf.append(reinterpret_cast<const char*>(xs), n*sizeof(double));
+      }
+
+      void putString(const string& s) {
+        put<uint64_t>(s.size());
+        buf.append(s);
+      }
+
+      /// All the sums of a distribution, in their in-memory order
+      template <typename DBN>
+      void putDbn(const DBN& d) {
+        putDoubles(d.sumsPtr(), sizeof(DBN)/sizeof(double));
+      }
+    };
+
+
+    /// Bounds-checked reader of an Encoder's output
+    struct Decoder {
+      const char* pos;
+      const char* end;
+
+      void need(size_t n) {
+        if (size_t(end - pos) < n) throw ReadError("Truncated binary analysis object data");
+      }
+
+      template <typename T>
+      T get() {
+        need(sizeof(T));
+        T x;
+        memcpy(&x, pos, sizeof(T));
+        pos += sizeof(T);
+        return x;
+      }
+
+      void getDoubles(double* xs, size_t n) {
+        need(n*sizeof(double));
+        memcpy(xs, pos, n*sizeof(double));
+        pos += n*sizeof(double);
+      }
+
+      string getString() {
+        const uint64_t n = get<uint64_t>();
+        need(n);
+        string s(pos, n);
+        pos += n;
+        return s;
+      }
+
+      /// Size for a container of @a n elements, each encoded in at least @a minbytes
+      size_t getCount(size_t minbytes) {
+        const uint64_t n = get<uint64_t>();
+        if (n > size_t(end - pos) / minbytes) throw ReadError("Corrupt binary analysis object data");
+        return n;
+      }
+
+      template <typename DBN>
+      DBN getDbn() {
+        DBN d;
+        getDoubles(d.sumsPtr(), sizeof(DBN)/sizeof(double));
+        return d;
+      }
+    };
+
+
+    template <typename H>
+    void _encodeBinned1D(Encoder& enc, const H& h) {
+      enc.buf.reserve(enc.buf.size() + (h.numBins()+3) * (sizeof(h.totalDbn()) + 2*sizeof(double)));
+      enc.putDbn(h.totalDbn());
+      enc.putDbn(h.underflow());
+      enc.putDbn(h.overflow());
+      enc.put<uint64_t>(h.numBins());
+      for (const auto& b : h.bins()) {
+        enc.put(b.xMin());
+        enc.put(b.xMax());
+        enc.putDbn(b.dbn());
+      }
+    }
+
+    template <typename H, typename DBN>
+    H* _decodeBinned1D(Decoder& dec) {
+      typedef typename H::Bin Bin;
+      const DBN tot = dec.getDbn<DBN>();
+      const DBN uflow = dec.getDbn<DBN>();
+      const DBN oflow = dec.getDbn<DBN>();
+      const size_t nbins = dec.getCount(sizeof(DBN) + 2*sizeof(double));
+      vector<Bin> bins;
+      bins.reserve(nbins);
+      for (size_t i = 0; i < nbins; ++i) {
+        const double xmin = dec.get<double>(), xmax = dec.get<double>();
+        bins.push_back(Bin(make_pair(xmin, xmax), dec.getDbn<DBN>()));
+      }
+      return new H(bins, tot, uflow, oflow);
+    }
+
+
+    template <typename H>
+    void _encodeBinned2D(Encoder& enc, const H& h) {
+      enc.buf.reserve(enc.buf.size() + (h.numBins()+1) * (sizeof(h.totalDbn()) + 4*sizeof(double)));
+      enc.putDbn(h.totalDbn());
+      enc.put<uint64_t>(h.numBins());
+      for (const auto& b : h.bins()) {
+        enc.put(b.xMin());
+        enc.put(b.xMax());
+        enc.put(b.yMin());
+        enc.put(b.yMax());
+        enc.putDbn(b.dbn());
+      }
+    }
+
+    template <typename H, typename DBN>
+    H* _decodeBinned2D(Decoder& dec) {
+      typedef typename H::Bin Bin;
+      typedef typename H::Outflows Outflows;
+      const DBN tot = dec.getDbn<DBN>();
+      const size_t nbins = dec.getCount(sizeof(DBN) + 4*sizeof(double));
+      vector<Bin> bins;
+      bins.reserve(nbins);
+      for (size_t i = 0; i < nbins; ++i) {
+        const double xmin = dec.get<double>(), xmax = dec.get<double>();
+        const double ymin = dec.get<double>(), ymax = dec.get<double>();
+        bins.push_back(Bin(make_pair(xmin, xmax), make_pair(ymin, ymax), dec.getDbn<DBN>()));
+      }
+      return new H(bins, tot, Outflows(8));
+    }
+
+
+    /// @brief Points as their values and lower-dimension errors, then the (ID, errors) of each set variation
+    ///
+    /// The nominal error on the highest dimension is variation 0, which may be unset.
+    template <size_t DIM, typename S>
+    void _encodeScatter(Encoder& enc, const S& s) {
+      const vector<string>& varnames = s.variationTable().names();
+      enc.put<uint64_t>(varnames.size());
+      for (const string& name : varnames) enc.putString(name);
+      enc.buf.reserve(enc.buf.size() + s.numPoints() * (3*DIM+2) * sizeof(double));
+      enc.put<uint64_t>(s.numPoints());
+      for (const auto& pt : s.points()) {
+        for (size_t i = 1; i < DIM; ++i) {
+          enc.put(pt.val(i));
+          enc.put(pt.errMinus(i));
+          enc.put(pt.errPlus(i));
+        }
+        enc.put(pt.val(DIM));
+        uint64_t nvars = 0;
+        for (size_t id = 0; id < pt.numVariationSlots(); ++id)
+          if (pt.hasVariation(id)) nvars += 1;
+        enc.put(nvars);
+        for (size_t id = 0; id < pt.numVariationSlots(); ++id) {
+          if (!pt.hasVariation(id)) continue;
+          enc.put<uint64_t>(id);
+          enc.put(pt.variationErrs(id).first);
+          enc.put(pt.variationErrs(id).second);
+        }
+      }
+    }
+
+    template <typename S, size_t DIM>
+    S* _decodeScatter(Decoder& dec) {
+      typedef typename S::Point Point;
+      // Points share a table in the encoded ID order, re-indexed once when adopted by the scatter
+      typename Point::VariationTablePtr table = make_shared<Utils::VariationTable>();
+      for (size_t id = 0, n = dec.getCount(sizeof(uint64_t)); id < n; ++id) {
+        const string name = dec.getString();
+        if (table->intern(name) != id) throw ReadError("Corrupt variation table in binary analysis object data");
+      }
+      const size_t npts = dec.getCount((3*DIM-2)*sizeof(double) + sizeof(uint64_t));
+      vector<Point> pts;
+      pts.reserve(npts);
+      for (size_t ip = 0; ip < npts; ++ip) {
+        Point pt;
+        for (size_t i = 1; i < DIM; ++i) {
+          const double val = dec.get<double>();
+          const double eminus = dec.get<double>(), eplus = dec.get<double>();
+          pt.set(i, val, eminus, eplus);
+        }
+        pt.setVal(DIM, dec.get<double>());
+        pt.setVariationTable(table);
+        for (size_t iv = 0, nv = dec.getCount(3*sizeof(double)); iv < nv; ++iv) {
+          const size_t id = dec.get<uint64_t>();
+          const double eminus = dec.get<double>(), eplus = dec.get<double>();
+          pt.setVariationErrs(id, make_pair(eminus, eplus));
+        }
+        pts.push_back(pt);
+      }
+      S* s = new S();
+      s->addPoints(pts);
+      return s;
+    }
+
+  }
+
+
+  string serialize(const AnalysisObject& ao) {
+    Encoder enc;
+    enc.buf.reserve(4096);
+    enc.put(MAGIC);
+    const size_t itype = enc.buf.size();
+    enc.put<uint32_t>(0);
+    const vector<string> annotations = ao.annotations();
+    enc.put<uint64_t>(annotations.size());
+    for (const string& a : annotations) {
+      enc.putString(a);
+      enc.putString(ao.annotation(a));
+    }
+
+    TypeCode type;
+    if (const Counter* c = dynamic_cast<const Counter*>(&ao)) {
+      type = COUNTER;
+      enc.putDbn(c->dbn());
+    } else if (const Histo1D* h1 = dynamic_cast<const Histo1D*>(&ao)) {
+      type = HISTO1D;
+      _encodeBinned1D(enc, *h1);
+    } else if (const Histo2D* h2 = dynamic_cast<const Histo2D*>(&ao)) {
+      type = HISTO2D;
+      _encodeBinned2D(enc, *h2);
+    } else if (const Profile1D* p1 = dynamic_cast<const Profile1D*>(&ao)) {
+      type = PROFILE1D;
+      _encodeBinned1D(enc, *p1);
+    } else if (const Profile2D* p2 = dynamic_cast<const Profile2D*>(&ao)) {
+      type = PROFILE2D;
+      _encodeBinned2D(enc, *p2);
+    } else if (const Scatter1D* s1 = dynamic_cast<const Scatter1D*>(&ao)) {
+      type = SCATTER1D;
+      _encodeScatter<1>(enc, *s1);
+    } else if (const Scatter2D* s2 = dynamic_cast<const Scatter2D*>(&ao)) {
+      type = SCATTER2D;
+      _encodeScatter<2>(enc, *s2);
+    } else if (const Scatter3D* s3 = dynamic_cast<const Scatter3D*>(&ao)) {
+      type = SCATTER3D;
+      _encodeScatter<3>(enc, *s3);
+    } else {
+      throw WriteError("Unsupported analysis object type for binary encoding: " + ao.type());
+    }
+    const uint32_t code = type;
+    memcpy(&enc.buf[itype], &code, sizeof(code));
+    return enc.buf;
+  }
+
+
+  AnalysisObject* deserialize(const char* data, size_t size) {
+    Decoder dec{data, data + size};
+    if (dec.get<uint32_t>() != MAGIC)
+      throw ReadError("Not a binary-encoded analysis object, or encoded with a different byte order");
+    const uint32_t type = dec.get<uint32_t>();
+    AnalysisObject::Annotations anns;
+    for (size_t i = 0, n = dec.getCount(2*sizeof(uint64_t)); i < n; ++i) {
+      const string key = dec.getString();
+      anns[key] = dec.getString();
+    }
+
+    unique_ptr<AnalysisObject> ao;
+    switch (type) {
+    case COUNTER:
+      ao.reset(new Counter(dec.getDbn<Dbn0D>()));
+      break;
+    case HISTO1D:
+      ao.reset(_decodeBinned1D<Histo1D, Dbn1D>(dec));
+      break;
+    case HISTO2D:
+      ao.reset(_decodeBinned2D<Histo2D, Dbn2D>(dec));
+      break;
+    case PROFILE1D:
+      ao.reset(_decodeBinned1D<Profile1D, Dbn2D>(dec));
+      break;
+    case PROFILE2D:
+      ao.reset(_decodeBinned2D<Profile2D, Dbn3D>(dec));
+      break;
+    case SCATTER1D:
+      ao.reset(_decodeScatter<Scatter1D, 1>(dec));
+      break;
+    case SCATTER2D:
+      ao.reset(_decodeScatter<Scatter2D, 2>(dec));
+      break;
+    case SCATTER3D:
+      ao.reset(_decodeScatter<Scatter3D, 3>(dec));
+      break;
+    default:
+      throw ReadError("Unknown type code in binary analysis object data");
+    }
+    if (dec.pos != dec.end) throw ReadError("Trailing bytes after binary analysis object data");
+    ao->setAnnotations(anns);
+    return ao.release();
+  }
+
+
+}
@@ -0,0 +1,85 @@
+// -*- C++ -*-
+//
+// This file is part of YODA -- Yet more Objects for Data Analysis
+// Copyright (C) 2008-2018 The YODA collaboration (see AUTHORS for details)
+//
+#include "YODA/Stats.h"
+#include <sstream>
+#include <iomanip>
+using namespace std;
+
+namespace YODA {
+  namespace Stats {
+
+
+    atomic<uint64_t> _values[NUM_KEYS];
+
+
+    namespace {
+
+      /// Names of the keys, in order, with timers ending in "_ns"
+      const char* NAMES[NUM_KEYS] = {
+        "binsearch_direct", "binsearch_linear", "binsearch_bisect",
+        "histo1d_fill_inrange", "histo1d_fill_gap", "histo1d_fill_underflow",
+        "histo1d_fill_overflow", "histo1d_fill_nan",
+        "reader_objects", "reader_lines", "reader_ns", "reader_yaml_ns", "reader_build_ns",
+        "writer_objects", "writer_ns"
+      };
+
+      double _get(Key key) {
+        return _values[key].load(memory_order_relaxed);
+      }
+
+    }
+
+
+    bool enabled() {
+      #ifdef YODA_STATS
+      return true;
+      #else
+      return false;
+      #endif
+    }
+
+
+    map<string, double> values() {
+      map<string, double> rtn;
+      for (size_t i = 0; i < NUM_KEYS; ++i) {
+        const string name = NAMES[i];
+        if (name.size() > 3 && name.compare(name.size()-3, 3, "_ns") == 0) {
+          rtn[name.substr(0, name.size()-3) + "_seconds"] = _get(Key(i)) / 1e9;
+        } else {
+          rtn[name] = _get(Key(i));
+        }
+      }
+      const double tokenize = _get(READER_NS) - _get(READER_YAML_NS) - _get(READER_BUILD_NS);
+      rtn["reader_tokenize_seconds"] = max(tokenize, 0.0) / 1e9;
+      return rtn;
+    }
+
+
+    void reset() {
+      for (auto& v : _values) v.store(0, memory_order_relaxed);
+    }
+
+
+    string summary() {
+      const map<string, double> vals = values();
+      const double nlookups = vals.at("binsearch_direct") + vals.at("binsearch_linear") + vals.at("binsearch_bisect");
+      const double nfills = vals.at("histo1d_fill_inrange") + vals.at("histo1d_fill_gap") + vals.at("histo1d_fill_underflow") +
+        vals.at("histo1d_fill_overflow") + vals.at("histo1d_fill_nan");
+      ostringstream oss;
+      oss << "YODA statistics" << (enabled() ? "" : " (disabled in this build: configure with --enable-stats)") << "\n";
+      for (const auto& kv : vals) {
+        oss << "  " << left << setw(28) << kv.first << " " << setprecision(6) << kv.second;
+        const double total = (kv.first.find("binsearch_") == 0) ? nlookups :
+          (kv.first.find("histo1d_fill_") == 0) ? nfills : 0;
+        if (total > 0) oss << "  (" << fixed << setprecision(1) << 100*kv.second/total << "%)" << defaultfloat;
+        oss << "\n";
+      }
+      return oss.str();
+    }
+
+
+  }
+}
@@ -8,6 +8,7 @@
 #include "YODA/WriterAIDA.h"
 #include "YODA/WriterFLAT.h"
 #include "YODA/Config/BuildConfig.h"
+#include "YODA/Stats.h"
 
 #ifdef HAVE_LIBZ
 #define _XOPEN_SOURCE 700
@@ -17,25 +18,40 @@
 #include <iostream>
 #include <typeinfo>
 #include <sstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
 using namespace std;
 
 namespace YODA {
 
 
-  Writer& mkWriter(const string& name) {
-    // Determine the format from the string (a file or file extension)
-    const size_t lastdot = name.find_last_of(".");
-    string fmt = Utils::toLower(lastdot == string::npos ? name : name.substr(lastdot+1));
-    const bool compress = (fmt == "gz");
-    //cout << "***" << compress << endl;
-    if (compress) {
-      #ifndef HAVE_LIBZ
-      throw UserError("YODA was compiled without zlib support: can't write " + name);
-      #endif
-      const size_t lastbutonedot = (lastdot == string::npos) ? string::npos : name.find_last_of(".", lastdot-1);
-      fmt = Utils::toLower(lastbutonedot == string::npos ? name : name.substr(lastbutonedot+1));
+  namespace {
+
+    /// Determine the format (e.g. "yoda") from a file name or extension, and whether it's compressed
+    string _writerFormat(const string& name, bool& compress) {
+      const size_t lastdot = name.find_last_of(".");
+      string fmt = Utils::toLower(lastdot == string::npos ? name : name.substr(lastdot+1));
+      compress = (fmt == "gz");
+      if (compress) {
+        #ifndef HAVE_LIBZ
+        throw UserError("YODA was compiled without zlib support: can't write " + name);
+        #endif
+        const size_t lastbutonedot = (lastdot == string::npos) ? string::npos : name.find_last_of(".", lastdot-1);
+        fmt = Utils::toLower(lastbutonedot == string::npos ? name : name.substr(lastbutonedot+1));
+      }
+      return fmt;
     }
-    // Create the appropriate Writer
+
+  }
+
+
+  Writer& mkWriter(const string& name) {
+    bool compress;
+    const string fmt = _writerFormat(name, compress);
+    // Get the appropriate Writer
     Writer* w = nullptr;
     if (Utils::startswith(fmt, "yoda")) w = &WriterYODA::create();
     if (Utils::startswith(fmt, "aida")) w = &WriterAIDA::create();
@@ -47,22 +63,53 @@ namespace YODA {
   }
 
 
+  unique_ptr<Writer> mkWriter(const string& name, const WriterOptions& opts) {
+    bool compress;
+    const string fmt = _writerFormat(name, compress);
+    // Create the appropriate Writer
+    unique_ptr<Writer> w;
+    if (Utils::startswith(fmt, "yoda")) w.reset(new WriterYODA());
+    if (Utils::startswith(fmt, "aida")) w.reset(new WriterAIDA());
+    if (Utils::startswith(fmt, "dat" )) w.reset(new WriterFLAT());
+    if (Utils::startswith(fmt, "flat")) w.reset(new WriterFLAT());
+    if (!w) throw UserError("Format cannot be identified from string '" + name + "'");
+    #ifndef HAVE_LIBZ
+    if (opts.compress) throw UserError("YODA was compiled without zlib support: can't write " + name);
+    #endif
+    w->setPrecision(opts.precision);
+    w->useCompression(compress || opts.compress);
+    w->setThreads(opts.nthreads);
+    return w;
+  }
+
+
   void Writer::write(const std::string& filename, const AnalysisObject& ao) {
     std::vector<const AnalysisObject*> vec{&ao};
     write(filename, vec);
   }
 
-  // Canonical writer function, including compression handling
   void Writer::write(ostream& stream, const vector<const AnalysisObject*>& aos) {
+    _write(stream, aos, _compress);
+  }
+
+  // Canonical writer function, including compression handling
+  void Writer::_write(ostream& stream, const vector<const AnalysisObject*>& aos, bool compress) {
+    YODA_STATS_TIME(WRITER_NS);
+    YODA_STATS_ADD(WRITER_OBJECTS, aos.size());
+    if (_nthreads > 1 && aos.size() > 1) {
+      _writeParallel(stream, aos, compress);
+      return;
+    }
+
     std::unique_ptr<std::ostream> zos;
     std::ostream* os = &stream;
 
     // Wrap the stream if needed
-    if (_compress) {
+    if (compress) {
       #ifdef HAVE_LIBZ
       // Doesn't work to always create zstr wrapper: have to only create if compressing :-/
       // zstr::ostream zstream(stream);
-      // ostream& os = _compress ? zstream : stream;
+      // ostream& os = compress ? zstream : stream;
       os = new zstr::ostream(stream);
       zos.reset(os);
       #else
@@ -89,6 +136,99 @@ namespace YODA {
   }
 
 
+  void Writer::_writeParallel(ostream& stream, const vector<const AnalysisObject*>& aos, bool compress) {
+    #ifndef HAVE_LIBZ
+    if (compress) throw UserError("YODA was compiled without zlib support: can't write to a compressed stream");
+    #endif
+
+    // Text as it is to be written: as is, or as a complete gzip member if compressing
+    auto pack = [&](const string& text) {
+      if (!compress || text.empty()) return text;
+      ostringstream oss;
+      #ifdef HAVE_LIBZ
+      {
+        zstr::ostream zos(oss);
+        zos << text;
+      }
+      #endif
+      return oss.str();
+    };
+
+    // The objects are split into contiguous chunks, a few per thread to balance the load
+    struct Chunk {
+      string data, warnings;
+      bool empty = true, done = false;
+      exception_ptr err;
+    };
+    const size_t nthreads = min(_nthreads, aos.size());
+    const size_t nchunks = min(aos.size(), 4*nthreads);
+    vector<Chunk> chunks(nchunks);
+    mutex mtx;
+    condition_variable cv;
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+      for (size_t ic = next++; ic < nchunks; ic = next++) {
+        Chunk& ch = chunks[ic];
+        try {
+          ostringstream oss;
+          streamoff len = 0;
+          for (size_t i = ic*aos.size()/nchunks; i < (ic+1)*aos.size()/nchunks; ++i) {
+            try {
+              if (!ch.empty) oss << "\n"; //< blank line between items
+              writeBody(oss, aos[i]);
+              len = oss.tellp();
+              ch.empty = false;
+            } catch (const LowStatsError& ex) {
+              // Drop any partial output, and report it in order with the other chunks
+              oss.seekp(len);
+              ch.warnings += "LowStatsError in writing AnalysisObject " + aos[i]->title() + ":\n" + ex.what() + "\n";
+            }
+          }
+          ch.data = pack(oss.str().substr(0, len));
+        } catch (...) {
+          ch.err = current_exception();
+        }
+        lock_guard<mutex> lock(mtx);
+        ch.done = true;
+        cv.notify_all();
+      }
+    };
+    vector<thread> threads;
+    for (size_t i = 0; i < nthreads; ++i) threads.push_back(thread(worker));
+
+    // Append the chunks in order as they are completed
+    exception_ptr err;
+    try {
+      ostringstream head;
+      writeHead(head);
+      stream << pack(head.str());
+      const string sep = pack("\n");
+      bool first = true;
+      for (Chunk& ch : chunks) {
+        {
+          unique_lock<mutex> lock(mtx);
+          cv.wait(lock, [&]() { return ch.done; });
+        }
+        if (ch.err) rethrow_exception(ch.err);
+        std::cerr << ch.warnings;
+        if (ch.empty) continue;
+        if (!first) stream << sep;
+        stream << ch.data;
+        string().swap(ch.data);
+        first = false;
+      }
+      ostringstream foot;
+      writeFoot(foot);
+      stream << pack(foot.str()) << flush;
+    } catch (...) {
+      err = current_exception();
+      next = nchunks;
+    }
+    for (thread& t : threads) t.join();
+    if (err) rethrow_exception(err);
+  }
+
+
   void Writer::writeBody(ostream& stream, const AnalysisObject* ao) {
     if (!ao) throw WriteError("Attempting to write a null AnalysisObject*");
     writeBody(stream, *ao);
@@ -13,9 +13,9 @@ using namespace std;
 
 namespace YODA {
 
-  /// Singleton creation function
+  /// Creation function for the calling thread's shared instance
   Writer& WriterAIDA::create() {
-    static WriterAIDA _instance;
+    static thread_local WriterAIDA _instance;
     _instance.setPrecision(6);
     return _instance;
   }
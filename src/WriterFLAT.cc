@@ -21,9 +21,9 @@ using namespace std;
 
 namespace YODA {
 
-  /// Singleton creation function
+  /// Creation function for the calling thread's shared instance
   Writer& WriterFLAT::create() {
-    static WriterFLAT _instance;
+    static thread_local WriterFLAT _instance;
     _instance.setPrecision(6);
     return _instance;
   }
@@ -16,9 +16,9 @@ using namespace std;
 
 namespace YODA {
 
-  /// Singleton creation function
+  /// Creation function for the calling thread's shared instance
   Writer& WriterYODA::create() {
-    static WriterYODA _instance;
+    static thread_local WriterYODA _instance;
     _instance.setPrecision(6);
     return _instance;
   }
@@ -37,10 +37,50 @@ namespace YODA {
   }
 
 
-  void WriterYODA::_writeAnnotations(std::ostream& os, const AnalysisObject& ao) {
+  // Scatter error breakdowns: each variation beyond the nominal is written as
+  // an extra err-/err+ column pair, labelled "err-(name)" in the column-header
+  // comment, with "-" marking a source which is missing for a given point.
+  // This is read back in the same pass as the points, and older readers just
+  // ignore the extra columns.
+
+  // Get the IDs of the non-nominal variations actually used by the scatter's points
+  template <typename SCATTER>
+  inline vector<size_t> _variationIDs(const SCATTER& s) {
+    vector<size_t> rtn;
+    for (const string& v : s.variations()) {
+      if (!v.empty()) rtn.push_back(s.variationTable().find(v));
+    }
+    return rtn;
+  }
+
+  // Append the labels for the error-breakdown columns to the column header
+  inline void _writeVariationHeaders(std::ostream& os, const string& err, const vector<size_t>& varids,
+                                     const Utils::VariationTable& vartable) {
+    for (size_t id : varids) {
+      os << " " << err << "-(" << vartable.name(id) << ")\t";
+      os << " " << err << "+(" << vartable.name(id) << ")\t";
+    }
+  }
+
+  // Append a point's error-breakdown columns
+  inline void _writeVariationErrs(std::ostream& os, const Point& pt, const vector<size_t>& varids) {
+    for (size_t id : varids) {
+      if (pt.hasVariation(id)) {
+        const pair<double,double>& e = pt.variationErrs(id);
+        os << "\t" << e.first << "\t" << e.second;
+      } else {
+        os << "\t-\t-";
+      }
+    }
+  }
+
+
+  void WriterYODA::_writeAnnotations(std::ostream& os, const AnalysisObject& ao, bool skipErrorBreakdown) {
     os << scientific << setprecision(_precision);
     for (const string& a : ao.annotations()) {
       if (a.empty()) continue;
+      // The error breakdown is superseded by the extra point columns when they are written
+      if (skipErrorBreakdown && a == "ErrorBreakdown") continue;
       /// @todo Write out floating point annotations as scientific notation
       string ann = ao.annotation(a);
       // remove stpurious line returns at the end of a string so that we don't
@@ -250,16 +290,20 @@ namespace YODA {
     os << scientific << showpoint << setprecision(_precision);
 
     os << "BEGIN " << _iotypestr("SCATTER1D") << " " << s.path() << "\n";
-    _writeAnnotations(os, s);
+    const vector<size_t> varids = _variationIDs(s);
+    _writeAnnotations(os, s, !varids.empty());
      
     //write headers
     std::string headers="# xval\t xerr-\t xerr+\t";
-    os << headers << "\n";
+    os << headers;
+    _writeVariationHeaders(os, "xerr", varids, s.variationTable());
+    os << "\n";
     
     //write points
     for (const Point1D& pt : s.points()) {
       // fill central value
       os << pt.x() << "\t" << pt.xErrMinus() << "\t" << pt.xErrPlus() ;
+      _writeVariationErrs(os, pt, varids);
       os <<  "\n";
     }
     os << "END " << _iotypestr("SCATTER1D") << "\n\n";
@@ -274,12 +318,15 @@ namespace YODA {
     os << scientific << showpoint << setprecision(_precision);
     os << "BEGIN " << _iotypestr("SCATTER2D") << " " << s.path() << "\n";
     //  write annotations
-    _writeAnnotations(os, s);
+    const vector<size_t> varids = _variationIDs(s);
+    _writeAnnotations(os, s, !varids.empty());
     
     //write headers
     /// @todo Change ordering to {vals} {errs} {errs} ...
     std::string headers="# xval\t xerr-\t xerr+\t yval\t yerr-\t yerr+\t";
-    os << headers << "\n";
+    os << headers;
+    _writeVariationHeaders(os, "yerr", varids, s.variationTable());
+    os << "\n";
     
     //write points
     for (const Point2D& pt : s.points()) {
@@ -287,6 +334,7 @@ namespace YODA {
       // fill central value
       os << pt.x() << "\t" << pt.xErrMinus() << "\t" << pt.xErrPlus() << "\t";
       os << pt.y() << "\t" << pt.yErrMinus() << "\t" << pt.yErrPlus() ;
+      _writeVariationErrs(os, pt, varids);
       os <<  "\n";
     }
     os << "END " << _iotypestr("SCATTER2D") << "\n\n";
@@ -301,13 +349,15 @@ namespace YODA {
     os << scientific << showpoint << setprecision(_precision);
     os << "BEGIN " << _iotypestr("SCATTER3D") << " " << s.path() << "\n";
     //  write the annotations
-    _writeAnnotations(os, s);
+    const vector<size_t> varids = _variationIDs(s);
+    _writeAnnotations(os, s, !varids.empty());
     
-   // std::vector<std::string> variations= s.variations();
     //write headers
     /// @todo Change ordering to {vals} {errs} {errs} ...
-    std::string headers="# xval\t xerr-\t xerr+\t yval\t yerr-\t yerr+\t zval\t ";
-    os << headers << "\n";
+    std::string headers="# xval\t xerr-\t xerr+\t yval\t yerr-\t yerr+\t zval\t zerr-\t zerr+\t";
+    os << headers;
+    _writeVariationHeaders(os, "zerr", varids, s.variationTable());
+    os << "\n";
     
     //write points
     for (const Point3D& pt : s.points()) {
@@ -316,6 +366,7 @@ namespace YODA {
       os << pt.x() << "\t" << pt.xErrMinus() << "\t" << pt.xErrPlus() << "\t";
       os << pt.y() << "\t" << pt.yErrMinus() << "\t" << pt.yErrPlus() << "\t";
       os << pt.z() << "\t" << pt.zErrMinus() << "\t" << pt.zErrPlus() ;
+      _writeVariationErrs(os, pt, varids);
       os <<  "\n";
     }
     os << "END " << _iotypestr("SCATTER3D") << "\n\n";
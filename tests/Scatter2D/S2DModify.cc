@@ -1,5 +1,8 @@
 #include "YODA/Scatter2D.h"
+#include "YODA/WriterYODA.h"
+#include "YODA/ReaderYODA.h"
 #include "YODA/Utils/Formatting.h"
+#include <sstream>
 
 using namespace YODA;
 using namespace std;
@@ -147,6 +150,76 @@ int main() {
   MSG_GREEN("PASS");
 
 
+  MSG_(PAD(70) << "Adding error-breakdown variations: ");
+  s1.point(0).setYErrs(0.5, 0.6, "syst1");
+  Point2D p4(2000, 1, 0, 0);
+  p4.setYErrs(0.1, 0.2, "syst2");
+  p4.setYErrs(0.3, 0.3, "syst1");
+  s1.addPoint(p4);
+  if (s1.variations().size() != 3 ||
+      s1.point(0).yErrPlus("syst1") != 0.6 ||
+      s1.point(11).yErrPlus("syst1") != 0.3 ||
+      s1.point(11).yErrMinus("syst2") != 0.1 ||
+      s1.point(0).variationTable() != s1.point(11).variationTable()) {
+    MSG_RED("FAIL");
+    return -1;
+  }
+  MSG_GREEN("PASS");
+
+
+  MSG_(PAD(70) << "Scaling a copy with variations: ");
+  Scatter2D s2 = s1;
+  s2.scaleY(2);
+  if (s2.point(0).yErrPlus("syst1") != 1.2 || s1.point(0).yErrPlus("syst1") != 0.6 ||
+      s2.point(11).yErrMinus("syst2") != 0.2 ||
+      s2.point(0).variationTable() == s1.point(0).variationTable()) {
+    MSG_RED("FAIL");
+    return -1;
+  }
+  MSG_GREEN("PASS");
+
+
+  MSG_(PAD(70) << "Writing and reading back variations: ");
+  stringstream ss;
+  WriterYODA::create().write(ss, s1);
+  vector<AnalysisObject*> aos;
+  ReaderYODA::create().read(ss, aos);
+  Scatter2D* s3 = dynamic_cast<Scatter2D*>(aos.at(0));
+  if (s3 == nullptr || s3->variations() != s1.variations() ||
+      s3->point(0).yErrMinus("syst1") != 0.5 || s3->point(11).yErrPlus("syst2") != 0.2 ||
+      s3->point(1).errMap().size() != 1) {
+    MSG_RED("FAIL");
+    return -1;
+  }
+  delete s3;
+  MSG_GREEN("PASS");
+
+
+  MSG_(PAD(70) << "Building the covariance matrix: ");
+  s1.point(1).setYErrs(0.2, 0.2, "stat");
+  const CovarianceSplit cov = s1.covariance();
+  const vector<vector<double> > covM = s1.covarianceMatrix();
+  if (cov.total.size() != 12 || covM.size() != 12 ||
+      fabs(cov.correlated(0,11) - 0.55*0.3) > 1e-12 || cov.correlated(11,0) != cov.correlated(0,11) ||
+      fabs(cov.correlated(11,11) - (0.09 + 0.0225)) > 1e-12 ||
+      cov.uncorrelated(1,1) != 0.2*0.2 || cov.uncorrelated(0,1) != 0 || cov.correlated(1,1) != 0 ||
+      covM[0][11] != cov.total(0,11) || covM[1][1] != cov.total(1,1)) {
+    MSG_RED("FAIL");
+    return -1;
+  }
+  Scatter2D s4;
+  for (size_t i = 0; i < 300; ++i) {
+    Point2D p(i, 1);
+    for (size_t k = 0; k < 20; ++k) p.setYErrs(0.01*((i*k) % 7), 0.02*((i+k) % 5), "syst" + to_string(k));
+    s4.addPoint(p);
+  }
+  if (s4.covariance(false, 1).total.data() != s4.covariance(false, 4).total.data()) {
+    MSG_RED("FAIL");
+    return -1;
+  }
+  MSG_GREEN("PASS");
+
+
   MSG_(PAD(70) << "Trying to reset the scatter: ");
   s1.reset();
   if (s1.numPoints() != 0){
@@ -0,0 +1,83 @@
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Scatter2D.h"
+#include "YODA/Utils/Binning.h"
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace std;
+using namespace YODA;
+
+
+int fail(const string& msg) {
+  cerr << msg << endl;
+  return EXIT_FAILURE;
+}
+
+
+int main() {
+
+  const size_t ninst0 = Utils::Binning::numInstances();
+  {
+    // Identical binnings share one lookup structure
+    Histo1D::Axis a(100, 0.0, 1.0), b(100, 0.0, 1.0), c(50, 0.0, 1.0);
+    if (a.binning() != b.binning()) return fail("Identical 1D binnings not shared");
+    if (a.binning() == c.binning()) return fail("Different 1D binnings shared");
+    if (Utils::Binning::numInstances() != ninst0 + 2) return fail("Wrong number of binnings in use");
+    if (!(a == b) || a == c) return fail("1D binning comparison wrong");
+
+    // Copies share too, and changing a binning unshares it
+    Histo1D::Axis d(a);
+    if (d.binning() != a.binning()) return fail("Copied binning not shared");
+    d.rebinBy(2);
+    if (d.binning() == a.binning() || d.binning() != c.binning()) return fail("Rebinned binning not re-shared");
+    if (a.binning()->indexes().size() != 102) return fail("Rebinning changed a shared binning");
+
+    // Axes whose edges differ by rounding don't share, but still have compatible binnings
+    vector<double> edges = linspace(100, 0.0, 1.0);
+    edges[50] += 1e-12;
+    Histo1D::Axis e(edges);
+    if (e.binning() == a.binning()) return fail("Different edges shared");
+    if (!(e == a)) return fail("Fuzzy binning comparison broken");
+
+    // 2D binnings
+    Histo2D::Axis a2(10, make_pair(0.0, 1.0), 20, make_pair(0.0, 2.0));
+    Histo2D::Axis b2(10, make_pair(0.0, 1.0), 20, make_pair(0.0, 2.0));
+    Histo2D::Axis c2(20, make_pair(0.0, 1.0), 10, make_pair(0.0, 2.0));
+    if (a2.binning() != b2.binning()) return fail("Identical 2D binnings not shared");
+    if (a2.binning() == c2.binning() || a2 == c2) return fail("Transposed 2D binnings shared");
+  }
+  if (Utils::Binning::numInstances() != ninst0) return fail("Unused binnings not freed");
+
+  // Objects booked with the same binning, on several threads, add and divide as before
+  vector< unique_ptr<Histo1D> > hs(8);
+  vector<thread> threads;
+  for (size_t i = 0; i < hs.size(); ++i)
+    threads.emplace_back([&hs, i]() {
+        hs[i].reset(new Histo1D(40, 0.0, 4.0));
+        for (size_t j = 0; j < 100; ++j) hs[i]->fill(0.04*j + 0.001*i, 1.0 + i);
+      });
+  for (thread& t : threads) t.join();
+  if (Utils::Binning::numInstances() != ninst0 + 1) return fail("Binnings made on several threads not shared");
+  Histo1D sum = *hs[0];
+  for (size_t i = 1; i < hs.size(); ++i) sum += *hs[i];
+  if (!fuzzyEquals(sum.sumW(), 100*36.0)) return fail("Wrong sum of shared-binning histograms");
+  const Scatter2D ratio = *hs[1] / *hs[0];
+  if (ratio.numPoints() != 40 || !fuzzyEquals(ratio.point(0).y(), 2.0)) return fail("Wrong ratio of shared-binning histograms");
+
+  // Incompatible binnings are still caught
+  Histo1D other(40, 0.0, 4.1);
+  try {
+    sum += other;
+    return fail("Adding incompatible binnings didn't throw");
+  } catch (const LogicError&) {  }
+  try {
+    divide(sum, other);
+    return fail("Dividing incompatible binnings didn't throw");
+  } catch (const BinningError&) {  }
+
+  return EXIT_SUCCESS;
+}
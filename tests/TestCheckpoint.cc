@@ -0,0 +1,70 @@
+#include "YODA/Checkpoint.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Counter.h"
+#include "YODA/ReaderYODA.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace std;
+using namespace YODA;
+
+
+int fail(const string& msg) {
+  cerr << msg << endl;
+  return EXIT_FAILURE;
+}
+
+
+int main() {
+
+  auto h1 = make_shared<Histo1D>(10, 0.0, 1.0, "/h1");
+  auto h2 = make_shared<Histo1D>(10, 0.0, 1.0, "/h2");
+  auto c = make_shared<Counter>("/c");
+  vector< shared_ptr<AnalysisObject> > aos = {h1, h2, c};
+
+  for (const string fname : {"testcheckpoint.yoda", "testcheckpoint.yoda.gz"}) {
+    CheckpointWriter cp(fname);
+
+    // The first checkpoint writes everything, later ones only what changed
+    h1->fill(0.1);
+    if (cp.write(aos) != 3) return fail("First checkpoint didn't write all objects");
+    if (cp.write(aos) != 0) return fail("Unchanged objects were written again");
+    h2->fill(0.5, 2.0);
+    c->fill();
+    if (cp.write(aos) != 2) return fail("Changed objects weren't written");
+    h2->bin(3).fillBin(1.0);
+    if (cp.write(aos) != 1) return fail("A change through a bin reference wasn't noticed");
+    h1->scaleW(3.0);
+    if (cp.write(aos) != 1) return fail("Scaling wasn't noticed");
+    if (cp.numCheckpoints() != 5) return fail("Wrong number of checkpoints");
+
+    // The file holds every version, and the reader mode the latest one
+    vector<AnalysisObject*> all;
+    ReaderYODA::create().read(fname, all);
+    for (AnalysisObject* ao : all) delete ao;
+    if (all.size() != 7) return fail("Wrong number of objects in " + fname);
+    vector<AnalysisObject*> latest = readCheckpoint(fname);
+    vector< unique_ptr<AnalysisObject> > owned(latest.begin(), latest.end());
+    if (latest.size() != 3 || latest[0]->path() != "/h1" || latest[2]->path() != "/c")
+      return fail("Wrong objects read from checkpoint " + fname);
+    if (fabs(dynamic_cast<Histo1D*>(latest[0])->sumW() - 3.0) > 1e-6 ||
+        fabs(dynamic_cast<Histo1D*>(latest[1])->sumW(false) - 3.0) > 1e-6 ||
+        dynamic_cast<Counter*>(latest[2])->numEntries() != 1)
+      return fail("Checkpoint " + fname + " doesn't hold the latest state");
+
+    // Compaction leaves only the latest versions
+    if (compactCheckpoint(fname) != 3) return fail("Wrong number of objects kept by compaction");
+    vector<AnalysisObject*> compacted;
+    ReaderYODA::create().read(fname, compacted);
+    for (AnalysisObject* ao : compacted) delete ao;
+    if (compacted.size() != 3) return fail("Compacted " + fname + " has the wrong number of objects");
+
+    h1->reset();
+    h2->reset();
+    c->reset();
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -22,5 +22,18 @@ int main() {
        << boolalpha << (iset[3] == 4)
        << endl;
 
-  return (iset[3] == 4) ? EXIT_SUCCESS : EXIT_FAILURE;
+  if (iset[3] != 4) return EXIT_FAILURE;
+
+  // Duplicates are ignored, by single or bulk insertion
+  if (iset.insert(3).second) return EXIT_FAILURE;
+  const int more[] = {10, 0, 5, 7, 10};
+  iset.insert(more, more+5);
+  const int expected[] = {0, 1, 2, 3, 4, 5, 7, 10};
+  if (iset.size() != 8) return EXIT_FAILURE;
+  for (size_t i = 0; i < iset.size(); ++i) {
+    if (iset[i] != expected[i]) return EXIT_FAILURE;
+  }
+  if (iset.count(6) != 0 || iset.index(7) != 6) return EXIT_FAILURE;
+  iset.erase(0);
+  return (iset[0] == 1 && iset.size() == 7) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
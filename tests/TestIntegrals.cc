@@ -0,0 +1,94 @@
+#include "YODA/Integrals.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include <iostream>
+
+using namespace std;
+using namespace YODA;
+
+
+int fail(const string& msg) {
+  cerr << msg << endl;
+  return EXIT_FAILURE;
+}
+
+
+int main() {
+
+  // 1D snapshot integrals agree with the histogram's own
+  Histo1D h(50, 0.0, 5.0);
+  for (size_t i = 0; i < 2000; ++i) h.fill(-0.5 + 6.0*(i % 97)/97.0, 1.0 + (i % 3));
+  const Histo1DIntegrals hi(h);
+  if (hi.numBins() != h.numBins()) return fail("Wrong number of snapshot bins");
+  for (size_t i1 = 0; i1 < h.numBins(); i1 += 7)
+    for (size_t i2 = i1; i2 < h.numBins(); i2 += 5)
+      if (!fuzzyEquals(hi.integralRange(i1, i2), h.integralRange(i1, i2))) return fail("Wrong integralRange");
+  for (size_t i = 0; i < h.numBins(); ++i) {
+    if (!fuzzyEquals(hi.integralTo(i), h.integralTo(i))) return fail("Wrong integralTo");
+    if (!fuzzyEquals(hi.integralTo(i, false), h.integralTo(i, false))) return fail("Wrong integralTo without underflow");
+  }
+  if (!fuzzyEquals(hi.integral(), h.sumW(false))) return fail("Wrong snapshot integral");
+  try {
+    hi.integralRange(0, h.numBins());
+    return fail("Out-of-range integral didn't throw");
+  } catch (const RangeError&) {  }
+
+  // The snapshot is unaffected by changes, while the histogram sees writes through kept bin references
+  HistoBin1D& b = h.bin(3);
+  const double before = h.integralTo(5);
+  b.fill(0.35, 2.0);
+  if (!fuzzyEquals(h.integralTo(5), before + 2.0) || !fuzzyEquals(h.sumW(false), hi.integral() + 2.0))
+    return fail("Histogram integrals missed a write through a bin reference");
+  if (!fuzzyEquals(hi.integralTo(5), before)) return fail("Snapshot changed with the histogram");
+
+
+  // 2D summed-area table on a regular grid
+  Histo2D h2(10, 0.0, 1.0, 8, 0.0, 2.0);
+  for (size_t i = 0; i < 1000; ++i) h2.fill((i % 31)/31.0, 2.0*(i % 17)/17.0, 1.0 + (i % 4));
+  const Histo2DIntegrals h2i(h2);
+  if (h2i.numCellsX() != 10 || h2i.numCellsY() != 8) return fail("Wrong 2D cell grid");
+  for (size_t ix1 = 0; ix1 < 10; ix1 += 3) {
+    for (size_t ix2 = ix1; ix2 < 10; ix2 += 2) {
+      for (size_t iy1 = 0; iy1 < 8; iy1 += 3) {
+        for (size_t iy2 = iy1; iy2 < 8; iy2 += 2) {
+          double sumw = 0;
+          for (const HistoBin2D& b2 : h2.bins()) {
+            const double x = b2.xMid(), y = b2.yMid();
+            if (x > 0.1*ix1 && x < 0.1*(ix2+1) && y > 0.25*iy1 && y < 0.25*(iy2+1)) sumw += b2.sumW();
+          }
+          if (!fuzzyEquals(h2i.integralRange(ix1, ix2, iy1, iy2), sumw)) return fail("Wrong 2D integralRange");
+        }
+      }
+    }
+  }
+  if (!fuzzyEquals(h2i.integralTo(9, 7), h2.sumW(false)) || !fuzzyEquals(h2i.integral(), h2.sumW(false)))
+    return fail("Wrong 2D total integral");
+  HistoBin2D& b2 = h2.bin(0);
+  const double sumw2 = h2.sumW(false);
+  b2.fill(0.05, 0.1, 5.0);
+  if (!fuzzyEquals(h2.sumW(false), sumw2 + 5.0)) return fail("2D sum missed a write through a bin reference");
+
+  // Bins spanning several cells count in their lowest one
+  vector<HistoBin2D> bins = { HistoBin2D(make_pair(0.0, 2.0), make_pair(0.0, 1.0)),
+                              HistoBin2D(make_pair(0.0, 1.0), make_pair(1.0, 2.0)),
+                              HistoBin2D(make_pair(1.0, 2.0), make_pair(1.0, 2.0)) };
+  Histo2D h3(bins);
+  h3.fill(1.5, 0.5, 1.0);
+  h3.fill(0.5, 1.5, 2.0);
+  h3.fill(1.5, 1.5, 4.0);
+  const Histo2DIntegrals h3i(h3);
+  if (!fuzzyEquals(h3i.integralTo(0, 0), 1.0) || !fuzzyEquals(h3i.integralTo(1, 0), 1.0) ||
+      !fuzzyEquals(h3i.integralTo(0, 1), 3.0) || !fuzzyEquals(h3i.integralTo(1, 1), 7.0) ||
+      !fuzzyEquals(h3i.integralRange(1, 1, 0, 1), 4.0))
+    return fail("Wrong integrals of irregular 2D binning");
+
+  // Empty histograms have nothing to integrate
+  const Histo2DIntegrals emptyi((Histo2D()));
+  if (emptyi.integral() != 0) return fail("Wrong integral of empty histo");
+  try {
+    emptyi.integralTo(0, 0);
+    return fail("Integral of empty histo didn't throw");
+  } catch (const RangeError&) {  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+#include "YODA/LiveExport.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Exceptions.h"
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <chrono>
+#include <unistd.h>
+#include <sys/wait.h>
+
+using namespace std;
+using namespace YODA;
+
+
+const size_t NUPDATES = 2000;
+const size_t NFILLS = 10;
+
+
+/// Take snapshots until the last update, checking that each is consistent, in a separate process
+int reader(const string& name) {
+  LiveReader r(name);
+  if (r.numObjects() != 3 || r.path(0) != "/live/h1" || r.path(2) != "/live/p1") {
+    cerr << "Wrong objects in the live export" << endl;
+    return 1;
+  }
+  const auto start = chrono::steady_clock::now();
+  double lastN = 0;
+  size_t nsnaps = 0;
+  while (true) {
+    // Take the update count first, so the snapshot is at least as recent
+    const bool last = r.numUpdates() == NUPDATES + 1;
+    vector<AnalysisObject*> aos = r.snapshot();
+    vector< unique_ptr<AnalysisObject> > owned(aos.begin(), aos.end());
+    nsnaps += 1;
+
+    // Every fill is in range, so the bins' entries add up to the total, unless the copy was torn
+    const Histo1D& h1 = dynamic_cast<const Histo1D&>(*aos[0]);
+    const Histo2D& h2 = dynamic_cast<const Histo2D&>(*aos[1]);
+    const Profile1D& p1 = dynamic_cast<const Profile1D&>(*aos[2]);
+    double n1 = 0, n2 = 0, np = 0;
+    for (const auto& b : h1.bins()) n1 += b.numEntries();
+    for (const auto& b : h2.bins()) n2 += b.numEntries();
+    for (const auto& b : p1.bins()) np += b.numEntries();
+    if (n1 != h1.numEntries() || n2 != h2.numEntries() || np != p1.numEntries()) {
+      cerr << "Inconsistent snapshot: " << n1 << " " << h1.numEntries() << " " << n2 << " "
+           << h2.numEntries() << " " << np << " " << p1.numEntries() << endl;
+      return 1;
+    }
+    if (h1.numEntries() < lastN) {
+      cerr << "Snapshots went back in time" << endl;
+      return 1;
+    }
+    lastN = h1.numEntries();
+
+    if (last) {
+      if (h1.numEntries() != NUPDATES*NFILLS || h2.numEntries() != NUPDATES*NFILLS || p1.numEntries() != NUPDATES*NFILLS) {
+        cerr << "Final snapshot doesn't hold all the fills" << endl;
+        return 1;
+      }
+      cout << "Took " << nsnaps << " consistent snapshots" << endl;
+      return 0;
+    }
+    if (chrono::steady_clock::now() - start > chrono::seconds(60)) {
+      cerr << "Timed out waiting for the last update" << endl;
+      return 1;
+    }
+  }
+}
+
+
+int main() {
+  Histo1D h1(20, 0.0, 1.0, "/live/h1");
+  Histo2D h2(10, 0.0, 1.0, 10, 0.0, 1.0, "/live/h2");
+  Profile1D p1(20, 0.0, 1.0, "/live/p1");
+  vector<AnalysisObject*> aos = {&h1, &h2, &p1};
+  const string name = "/yoda-testliveexport-" + to_string(getpid());
+
+  {
+    LiveExport live(name, aos);
+
+    // Fill and publish in this process while another reads
+    const pid_t pid = fork();
+    if (pid < 0) {
+      cerr << "Couldn't fork the reader process" << endl;
+      return EXIT_FAILURE;
+    }
+    if (pid == 0) _exit(reader(name));
+    for (size_t i = 0; i < NUPDATES; ++i) {
+      for (size_t j = 0; j < NFILLS; ++j) {
+        const double x = rand()/static_cast<double>(RAND_MAX), y = rand()/static_cast<double>(RAND_MAX);
+        h1.fill(x);
+        h2.fill(x, y);
+        p1.fill(x, y);
+      }
+      live.update();
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) return EXIT_FAILURE;
+  }
+
+  // The segment is removed with the exporter
+  try {
+    LiveReader r(name);
+    cerr << "Live export segment still exists after the exporter was destroyed" << endl;
+    return EXIT_FAILURE;
+  } catch (const ReadError&) { }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#include "YODA/Counter.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include "YODA/Profile1D.h"
+#include "YODA/Scatter2D.h"
+#include <iostream>
+#include <string>
+
+using namespace std;
+using namespace YODA;
+
+
+int fail(const string& msg) {
+  cerr << msg << endl;
+  return EXIT_FAILURE;
+}
+
+
+bool consistent(const MemoryUsage& m) {
+  return m.total() == m.object + m.bins + m.index + m.annotations + m.errors;
+}
+
+
+int main() {
+
+  // Bins and lookup structures scale with the number of bins
+  Histo1D h1small(10, 0.0, 1.0, "/h1small"), h1big(1000, 0.0, 1.0, "/h1big");
+  const MemoryUsage m1small = h1small.memoryUsage(), m1big = h1big.memoryUsage();
+  if (!consistent(m1big)) return fail("Histo1D total isn't the sum of its parts");
+  if (m1big.object != sizeof(Histo1D)) return fail("Histo1D object size wrong");
+  if (m1big.bins < 1000*sizeof(HistoBin1D)) return fail("Histo1D bins undercounted");
+  if (m1big.index < 1002*sizeof(double)) return fail("Histo1D bin searcher edges undercounted");
+  if (m1big.bins <= m1small.bins || m1big.index <= m1small.index) return fail("Histo1D memory doesn't grow with bins");
+  if (m1big.errors != 0) return fail("Histo1D has error-breakdown memory");
+
+  // Long annotations are counted
+  const size_t anns0 = h1small.memoryUsage().annotations;
+  h1small.setAnnotation("Description", string(1000, 'x'));
+  if (h1small.memoryUsage().annotations < anns0 + 1000) return fail("Annotation memory undercounted");
+
+  Histo2D h2(20, 0.0, 1.0, 30, 0.0, 1.0, "/h2");
+  const MemoryUsage m2 = h2.memoryUsage();
+  if (m2.bins < 600*sizeof(HistoBin2D) || m2.index < 53*sizeof(double)) return fail("Histo2D memory undercounted");
+
+  Profile1D p1(100, 0.0, 1.0, "/p1");
+  if (p1.memoryUsage().bins < 100*sizeof(ProfileBin1D)) return fail("Profile1D bins undercounted");
+
+  Counter c("/c");
+  const MemoryUsage mc = c.memoryUsage();
+  if (mc.bins != 0 || mc.index != 0 || mc.object != sizeof(Counter)) return fail("Counter memory wrong");
+
+  // Error breakdowns grow with the number of variations
+  Scatter2D s("/s");
+  for (size_t i = 0; i < 50; ++i) s.addPoint(i, 1.0, 0.5, 0.1);
+  const MemoryUsage ms0 = s.memoryUsage();
+  if (ms0.bins < 50*sizeof(Point2D)) return fail("Scatter2D points undercounted");
+  for (size_t i = 0; i < 50; ++i)
+    for (size_t v = 0; v < 10; ++v) s.point(i).setYErrs(0.01*v, "syst" + to_string(v));
+  const MemoryUsage ms1 = s.memoryUsage();
+  if (!consistent(ms1)) return fail("Scatter2D total isn't the sum of its parts");
+  if (ms1.errors < ms0.errors + 50*10*2*sizeof(double)) return fail("Scatter2D error breakdowns undercounted");
+
+  // Through the base class too
+  const AnalysisObject& ao = s;
+  if (ao.memoryUsage().total() != ms1.total()) return fail("Virtual memoryUsage() not used");
+
+  return EXIT_SUCCESS;
+}
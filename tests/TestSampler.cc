@@ -0,0 +1,87 @@
+#include "YODA/Sampler.h"
+#include "YODA/Histo1D.h"
+#include "YODA/Histo2D.h"
+#include <iostream>
+#include <cmath>
+
+using namespace std;
+using namespace YODA;
+
+
+int fail(const string& msg) {
+  cerr << msg << endl;
+  return EXIT_FAILURE;
+}
+
+
+int main() {
+
+  // Indices are drawn with frequencies matching the weights, exactly for uniform spacings
+  const vector<double> weights = { 1.0, 0.0, 3.0, 0.5, 2.5 };
+  const Utils::AliasTable table(weights);
+  vector<double> counts(weights.size(), 0.0);
+  const size_t nu = 70000;
+  for (size_t i = 0; i < nu; ++i) counts[table.index((i + 0.5)/nu)] += 1;
+  for (size_t i = 0; i < weights.size(); ++i)
+    if (fabs(counts[i] - nu*weights[i]/7.0) > 5) return fail("Alias table frequencies don't match the weights");
+  if (table.index(0.0) >= weights.size() || table.index(nextafter(1.0, 0.0)) >= weights.size())
+    return fail("Alias table index out of range");
+
+  // Draws from a 1D histogram refill it with the same shape
+  Histo1D h(vector<double>{0.0, 1.0, 1.5, 4.0, 5.0, 8.0});
+  h.fill(0.5, 2.0); h.fill(1.2, 1.0); h.fill(4.5, 4.0); h.fill(6.0, 3.0);
+  h.fill(-1.0, 100.0); // underflows are not sampled
+  Histo1DSampler s(h, 1234);
+  const size_t n = 1000000;
+  vector<double> xs(n);
+  s.sample(xs);
+  Histo1D hs(h.xEdges());
+  for (double x : xs) {
+    if (x < 0.0 || x >= 8.0) return fail("1D sample outside the histogram");
+    hs.fill(x);
+  }
+  for (size_t i = 0; i < h.numBins(); ++i) {
+    const double p = h.bin(i).sumW() / h.sumW(false);
+    if (fabs(hs.bin(i).sumW() - n*p) > 5*sqrt(n*p*(1-p)) + 1e-9) return fail("1D sample bin counts don't match the histogram");
+  }
+  if (hs.bin(2).sumW() != 0) return fail("Empty bin sampled");
+  // Uniform within the bins: the mean in the wide bin is at its middle
+  if (fabs(hs.bin(4).xMean() - 6.5) > 0.01) return fail("1D samples not uniform within a bin");
+
+  // The same seed gives the same sequence
+  Histo1DSampler s2(h, 1234);
+  if (s2.sample() != xs[0] || s2.sample() != xs[1]) return fail("Sampler not reproducible");
+  s2.seed(1234);
+  if (s2.sample() != xs[0]) return fail("Sampler not reseeded");
+
+  // Histograms which can't be sampled
+  Histo1D neg(4, 0.0, 1.0);
+  neg.fill(0.1, 1.0); neg.fill(0.6, -1.0);
+  try {
+    Histo1DSampler sn(neg);
+    return fail("Negative bin didn't throw");
+  } catch (const WeightError&) {  }
+  try {
+    Histo1DSampler se(Histo1D(4, 0.0, 1.0));
+    return fail("Empty histogram didn't throw");
+  } catch (const WeightError&) {  }
+
+
+  // 2D
+  Histo2D h2(4, 0.0, 4.0, 2, 0.0, 1.0);
+  for (size_t i = 0; i < h2.numBins(); ++i) h2.fillBin(i, 1.0 + i);
+  Histo2DSampler s3(h2, 42);
+  vector<double> ys(n);
+  s3.sample(xs.data(), ys.data(), n);
+  Histo2D h2s(4, 0.0, 4.0, 2, 0.0, 1.0);
+  for (size_t i = 0; i < n; ++i) h2s.fill(xs[i], ys[i]);
+  if (h2s.sumW(false) != n) return fail("2D sample outside the histogram");
+  for (size_t i = 0; i < h2.numBins(); ++i) {
+    const double p = h2.bin(i).sumW() / h2.sumW(false);
+    if (fabs(h2s.bin(i).sumW() - n*p) > 5*sqrt(n*p*(1-p))) return fail("2D sample bin counts don't match the histogram");
+  }
+  const pair<double,double> xy = s3.sample();
+  if (xy.first < 0 || xy.first >= 4 || xy.second < 0 || xy.second >= 1) return fail("2D sample outside the histogram");
+
+  return EXIT_SUCCESS;
+}
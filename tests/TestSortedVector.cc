@@ -21,5 +21,16 @@ int main() {
   for (int i = 0; i < 5; ++i) {
     if (sv[i] != i+1) return EXIT_FAILURE;
   }
+
+  // Bulk insertion: ordered tail, then unordered values to merge in
+  const int tail[] = {6, 7, 8};
+  sv.insert(tail, tail+3);
+  const int more[] = {9, 0, 4};
+  sv.insert(more, more+3);
+  const int expected[] = {0, 1, 2, 3, 4, 4, 5, 6, 7, 8, 9};
+  if (sv.size() != 11) return EXIT_FAILURE;
+  for (size_t i = 0; i < sv.size(); ++i) {
+    if (sv[i] != expected[i]) return EXIT_FAILURE;
+  }
   return EXIT_SUCCESS;
 }
@@ -0,0 +1,72 @@
+#include "YODA/Stats.h"
+#include "YODA/Histo1D.h"
+#include "YODA/ReaderYODA.h"
+#include "YODA/WriterYODA.h"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+using namespace YODA;
+
+
+int fail(const string& msg) {
+  cerr << msg << endl;
+  return EXIT_FAILURE;
+}
+
+
+int main() {
+
+  Stats::reset();
+
+  // A regular binning with a gap, then a bin of irregular width
+  Histo1D h("/h");
+  for (size_t i = 0; i < 50; ++i) h.addBin(i, i+1);
+  h.addBin(60, 100);
+  for (size_t i = 0; i < 1000; ++i) h.fill(0.05*i);
+  h.fill(55.0); //< in the gap
+  h.fill(-1.0);
+  h.fill(200.0);
+  try {
+    h.fill(NAN);
+    return fail("NaN fill didn't throw");
+  } catch (const RangeError&) {  }
+
+  ostringstream oss;
+  WriterYODA::write(oss, h);
+  istringstream iss(oss.str());
+  vector<AnalysisObject*> aos;
+  ReaderYODA::create().read(iss, aos);
+  for (AnalysisObject* ao : aos) delete ao;
+
+  const map<string, double> vals = Stats::values();
+  cout << Stats::summary();
+  for (const string key : {"binsearch_direct", "histo1d_fill_gap", "reader_yaml_seconds", "reader_tokenize_seconds"})
+    if (!vals.count(key)) return fail("Missing statistic " + key);
+
+  if (!Stats::enabled()) {
+    // Without --enable-stats nothing is recorded
+    for (const auto& kv : vals)
+      if (kv.second != 0) return fail("Statistic " + kv.first + " is non-zero in a build without them");
+    return EXIT_SUCCESS;
+  }
+
+  if (vals.at("histo1d_fill_inrange") != 1000) return fail("Wrong number of in-range fills");
+  if (vals.at("histo1d_fill_gap") != 1) return fail("Gap fill not counted");
+  if (vals.at("histo1d_fill_underflow") != 1 || vals.at("histo1d_fill_overflow") != 1) return fail("Under/overflow fills not counted");
+  if (vals.at("histo1d_fill_nan") != 1) return fail("NaN fill not counted");
+  const double nlookups = vals.at("binsearch_direct") + vals.at("binsearch_linear") + vals.at("binsearch_bisect");
+  if (nlookups < 1001) return fail("Bin lookups not counted");
+  if (vals.at("binsearch_direct") == 0) return fail("No direct estimator hits on a mostly regular binning");
+  if (vals.at("reader_objects") != 1 || vals.at("writer_objects") != 1) return fail("I/O objects not counted");
+  if (vals.at("reader_seconds") <= 0 || vals.at("reader_seconds") < vals.at("reader_yaml_seconds"))
+    return fail("Reader timers inconsistent");
+
+  Stats::reset();
+  for (const auto& kv : Stats::values())
+    if (kv.second != 0) return fail("Statistic " + kv.first + " not reset");
+
+  return EXIT_SUCCESS;
+}
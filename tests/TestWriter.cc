@@ -1,9 +1,12 @@
 #include "YODA/Histo1D.h"
 #include "YODA/WriterYODA.h"
+#include "YODA/ReaderYODA.h"
 #include <cmath>
 #include <vector>
 #include <iostream>
+#include <sstream>
 #include <memory>
+#include <thread>
 #include <type_traits>
 
 using namespace std;
@@ -30,5 +33,78 @@ int main() {
   WriterYODA::write("testwriter2.yoda", aos);
   WriterYODA::write("testwriter2.yoda.gz", aos);
 
+  // Writers of different precisions and compressions, used at the same time
+  // from several threads, must not pick up each other's settings
+  ostringstream ref3, ref9;
+  mkWriter("yoda", WriterOptions())->write(ref3, aos);
+  WriterOptions opts9;
+  opts9.precision = 9;
+  mkWriter("yoda", opts9)->write(ref9, aos);
+  vector<string> outs(8), errs(8);
+  vector<thread> threads;
+  for (size_t i = 0; i < outs.size(); ++i) {
+    threads.push_back(thread([&,i]() {
+      try {
+        for (size_t n = 0; n < 20; ++n) {
+          const string fname = "testwriter3-" + to_string(i) + (i % 2 ? ".yoda.gz" : ".yoda");
+          mkWriter(fname).write(fname, aos);
+          if (i % 4 < 2) mkWriter("yoda").write(fname + ".txt", aos);
+          ostringstream oss;
+          mkWriter("yoda", i % 4 < 2 ? opts9 : WriterOptions())->write(oss, aos);
+          outs[i] = oss.str();
+          vector<AnalysisObject*> back;
+          ReaderYODA::create().read(fname, back);
+          if (back.size() != 1) errs[i] = "Wrong number of objects read back from " + fname;
+          for (AnalysisObject* ao : back) delete ao;
+        }
+      } catch (const std::exception& e) {
+        errs[i] = e.what();
+      }
+    }));
+  }
+  for (thread& t : threads) t.join();
+  for (size_t i = 0; i < outs.size(); ++i) {
+    if (!errs[i].empty()) {
+      cerr << "Concurrent writer " << i << " failed: " << errs[i] << endl;
+      return EXIT_FAILURE;
+    }
+    if (outs[i] != (i % 4 < 2 ? ref9 : ref3).str()) {
+      cerr << "Concurrent writer " << i << " output differs from the serial output" << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Formatting on several threads gives the same output as on one, and
+  // compressed multi-threaded output reads back as the same objects
+  vector< shared_ptr<AnalysisObject> > many;
+  for (size_t i = 0; i < 100; ++i) {
+    auto hi = make_shared<Histo1D>(10+i, 0.0, 1.0, "/h" + to_string(i));
+    for (size_t n = 0; n < 100; ++n) hi->fill(rand()/static_cast<double>(RAND_MAX));
+    many.push_back(hi);
+  }
+  ostringstream serial, parallel;
+  WriterOptions optsmt;
+  optsmt.nthreads = 4;
+  mkWriter("yoda", WriterOptions())->write(serial, many);
+  mkWriter("yoda", optsmt)->write(parallel, many);
+  if (parallel.str() != serial.str()) {
+    cerr << "Multi-threaded writer output differs from the serial output" << endl;
+    return EXIT_FAILURE;
+  }
+  mkWriter("testwriter4.yoda.gz", WriterOptions())->write("testwriter4.yoda.gz", many);
+  mkWriter("testwriter5.yoda.gz", optsmt)->write("testwriter5.yoda.gz", many);
+  ostringstream reread4, reread5;
+  vector<AnalysisObject*> back4, back5;
+  ReaderYODA::create().read("testwriter4.yoda.gz", back4);
+  ReaderYODA::create().read("testwriter5.yoda.gz", back5);
+  mkWriter("yoda", WriterOptions())->write(reread4, back4);
+  mkWriter("yoda", WriterOptions())->write(reread5, back5);
+  for (AnalysisObject* ao : back4) delete ao;
+  for (AnalysisObject* ao : back5) delete ao;
+  if (back5.size() != many.size() || reread5.str() != reread4.str()) {
+    cerr << "Multi-threaded compressed output doesn't read back as the serial output does" << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }